@@ -18,14 +18,73 @@
 
 #include "apa102.h"
 
+#ifdef APA102_CORRECTION_AVAILABLE
+    #include "apa102_correction.h"
+#endif
+
+#ifdef APA102_CALIBRATION_AVAILABLE
+    #include "apa102_calibration.h"
+
+    static unsigned int apa102_position;
+#endif
+
+#ifdef APA102_RECORDER_AVAILABLE
+    #include "apa102_recorder.h"
+#endif
+
+#ifdef APA102_BUS_AVAILABLE
+    #include "apa102_bus.h"
+#endif
+
+static void apa102_transfer(unsigned char data)
+{
+    #ifdef APA102_RECORDER_AVAILABLE
+        apa102_recorder_write(data);
+    #endif
+
+    spi_transfer(data);
+}
+
+#if APA102_FRAME_FORMAT == APA102_FORMAT_HD108
+
+    static void apa102_encode_hd108(const GFX_RGBA_Color *color, unsigned char *frame)
+    {
+        unsigned char gain = color->alpha & APA102_MAX_INTENSITY;
+
+        frame[0] = 0x80 | (gain << 2) | (gain >> 3);
+        frame[1] = (unsigned char)(gain << 5) | gain;
+        frame[2] = color->red;
+        frame[3] = color->red;
+        frame[4] = color->green;
+        frame[5] = color->green;
+        frame[6] = color->blue;
+        frame[7] = color->blue;
+    }
+#else
+
+    static void apa102_encode_apa102(unsigned char flag, const GFX_RGBA_Color *color, unsigned char *frame)
+    {
+        frame[0] = (flag | (color->alpha & APA102_MAX_INTENSITY));
+        frame[1] = color->blue;
+        frame[2] = color->green;
+        frame[3] = color->red;
+    }
+#endif
+
 static void apa102_frame(unsigned char flag, const GFX_RGBA_Color *color)
 {
-    unsigned char temp = (flag | (color->alpha & APA102_MAX_INTENSITY));
+    unsigned char frame[APA102_LED_FRAME_SIZE];
+
+    #ifdef APA102_CALIBRATION_AVAILABLE
+        apa102_encode(apa102_position++, flag, color, frame);
+    #else
+        apa102_encode(0, flag, color, frame);
+    #endif
 
-    spi_transfer(temp);
-    spi_transfer(color->blue);
-    spi_transfer(color->green);
-    spi_transfer(color->red);
+    for (unsigned char i=0; i < APA102_LED_FRAME_SIZE; i++)
+    {
+        apa102_transfer(frame[i]);
+    }
 }
 
 /**
@@ -42,29 +101,135 @@ static void apa102_frame(unsigned char flag, const GFX_RGBA_Color *color)
 void apa102_init(void)
 {
     APA102_SOF();
-    for (unsigned char i=0; i < APA102_NUMBER_OF_LEDS; i++)
+    for (unsigned int i=0; i < APA102_NUMBER_OF_LEDS; i++)
     {
         apa102_frame(APA102_START_FLAG, &(GFX_RGBA_Color){APA102_MIN_INTENSITY, 0x00, 0x00, 0x00});
     }
     APA102_EOF();
 }
 
+/**
+ * @brief Encode a LED data frame in the selected frame format.
+ *
+ * @param led Position of the LED in the strip (used by the per-LED calibration, ignored otherwise).
+ * @param flag Mode flag of the LED frame (e.g. `APA102_START_FLAG`), ignored by `APA102_FORMAT_HD108`.
+ * @param color Pointer to the color and intensity of the LED.
+ * @param frame Buffer with at least `APA102_LED_FRAME_SIZE` bytes where the encoded LED frame is stored.
+ *
+ * @details
+ * This function runs the enabled color stages (color correction and per-LED calibration) and encodes the result with the encoder of the frame format selected by `APA102_FRAME_FORMAT`. The encoded frame can be sent directly via SPI or stored in a buffer for later transmission.
+ */
+void apa102_encode(unsigned int led, unsigned char flag, const GFX_RGBA_Color *color, unsigned char *frame)
+{
+    #ifdef APA102_CORRECTION_AVAILABLE
+        GFX_RGBA_Color corrected;
+
+        apa102_correction_apply(color, &corrected);
+        color = &corrected;
+    #endif
+
+    #ifdef APA102_CALIBRATION_AVAILABLE
+        GFX_RGBA_Color calibrated;
+
+        apa102_calibration_apply(led, color, &calibrated);
+        color = &calibrated;
+    #else
+        (void)led;
+    #endif
+
+    #if APA102_FRAME_FORMAT == APA102_FORMAT_HD108
+        (void)flag;
+        apa102_encode_hd108(color, frame);
+    #else
+        apa102_encode_apa102(flag, color, frame);
+    #endif
+}
+
+/**
+ * @brief Start a LED data sequence.
+ *
+ * @details
+ * This function runs the steps that belong to the beginning of a LED data sequence before the start frame is sent. With a shared bus the bus is locked, the LED position used by the per-LED calibration is reset and the recorder starts a new record. It is called by `apa102_xof()` and by transmissions that send the start frame themselves (e.g. `apa102_tx_poll()`).
+ */
+void apa102_sequence_begin(void)
+{
+    #ifdef APA102_BUS_AVAILABLE
+        apa102_bus_begin();
+    #endif
+
+    #ifdef APA102_CALIBRATION_AVAILABLE
+        apa102_position = 0;
+    #endif
+
+    #ifdef APA102_RECORDER_AVAILABLE
+        apa102_recorder_begin();
+    #endif
+}
+
+/**
+ * @brief Finish a LED data sequence.
+ *
+ * @details
+ * This function runs the steps that belong to the end of a LED data sequence after the end frame was sent. The recorder closes the record and with a shared bus the bus is released. It is called by `apa102_xof()` and by transmissions that send the end frame themselves (e.g. `apa102_tx_poll()`).
+ */
+void apa102_sequence_end(void)
+{
+    #ifdef APA102_RECORDER_AVAILABLE
+        apa102_recorder_end();
+    #endif
+
+    #ifdef APA102_BUS_AVAILABLE
+        apa102_bus_end();
+    #endif
+}
+
 /**
  * @brief Transmit a specified value repeatedly over SPI to form a data frame.
  *
  * @param value The byte value to be sent repeatedly.
  *
  * @details
- * This function sends the given `value` repeatedly for `LED_FRAME_SIZE` times via `SPI` using the `spi_transfer` function.
- * It is commonly used to send `start` or `stop` frames for LED data sequences to synchronize communication with the LED hardware.
+ * This function sends the given `value` repeatedly for `APA102_FRAME_SIZE` (start frame) or `APA102_EOF_SIZE` (end frame) times via `SPI` using the `spi_transfer` function.
+ * It is commonly used to send `start` or `stop` frames for LED data sequences to synchronize communication with the LED hardware. A start-of-frame calls `apa102_sequence_begin()` before the bytes are sent, an end-of-frame calls `apa102_sequence_end()` afterwards.
  *
  * @note The function blocks until all bytes are transmitted. Ensure the SPI interface is initialized before calling this function.
  */
 void apa102_xof(APA102_Transmission type)
 {
-    for (unsigned char i=0; i < APA102_FRAME_SIZE; i++)
+    if (type == APA102_Transmission_SOF)
+    {
+        apa102_sequence_begin();
+    }
+
+    unsigned int size = (type == APA102_Transmission_EOF) ? APA102_EOF_SIZE : APA102_FRAME_SIZE;
+
+    for (unsigned int i=0; i < size; i++)
+    {
+        apa102_transfer(type);
+    }
+
+    if (type == APA102_Transmission_EOF)
+    {
+        apa102_sequence_end();
+    }
+}
+
+/**
+ * @brief Transmit a buffer of already encoded bytes over SPI.
+ *
+ * @param data Pointer to the bytes that should be sent.
+ * @param length Number of bytes to send.
+ *
+ * @details
+ * This function sends the given bytes unchanged via `SPI`. It is used to transmit LED frames that were encoded in advance with `apa102_encode()`. Start and end frames are not added, use `APA102_SOF()` and `APA102_EOF()` around the transmission.
+ *
+ * @note The function blocks until all bytes are transmitted. Ensure the SPI interface is initialized before calling this function.
+ */
+void apa102_write(const unsigned char *data, unsigned int length)
+{
+    while (length--)
     {
-        spi_transfer(type);
+        apa102_transfer(*data++);
     }
 }
 
@@ -109,7 +274,7 @@ void apa102_leds(const GFX_RGBA_Color *color)
 {
     APA102_SOF();
 
-    for (unsigned char i=0; i < APA102_NUMBER_OF_LEDS; i++)
+    for (unsigned int i=0; i < APA102_NUMBER_OF_LEDS; i++)
     {
         apa102_frame(APA102_START_FLAG | (0x3F & color->alpha), color);
     }
@@ -155,7 +320,7 @@ void apa102_leds_off(void)
 {
     APA102_SOF();
 
-    for (unsigned char i=0; i < APA102_NUMBER_OF_LEDS; i++)
+    for (unsigned int i=0; i < APA102_NUMBER_OF_LEDS; i++)
     {
         apa102_led_off();
     }
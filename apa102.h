@@ -45,19 +45,91 @@
         #define APA102_NUMBER_OF_LEDS 1
     #endif
 
+    /**
+     * @def APA102_FORMAT_APA102
+     * @brief Frame format of the APA102 (and compatible e.g. SK9822) with a 4 byte LED frame.
+     *
+     * @details
+     * A LED frame consists of a mode byte (`APA102_START_FLAG` with the 5-bit global intensity) followed by the 8-bit blue, green and red color components.
+     */
+    #define APA102_FORMAT_APA102 0
+
+    /**
+     * @def APA102_FORMAT_HD108
+     * @brief Frame format of the HD108 with an 8 byte LED frame.
+     *
+     * @details
+     * A LED frame consists of a 16-bit header (start bit and a 5-bit gain for red, green and blue) followed by the 16-bit red, green and blue color components (MSB first). The 8-bit color components are expanded to 16-bit and the intensity is used as gain of all channels.
+     */
+    #define APA102_FORMAT_HD108 1
+
+    #ifndef APA102_FRAME_FORMAT
+        /**
+         * @def APA102_FRAME_FORMAT
+         * @brief Selects the frame format of the connected LED chips.
+         *
+         * @details
+         * Define this macro with `APA102_FORMAT_APA102` (default) or `APA102_FORMAT_HD108` to select the LED frame encoder at compile time. All functions of the driver use the selected encoder.
+         *
+         * @note Set this macro as a global compiler symbol to ensure that the same frame format is used across the entire project.
+         */
+        #define APA102_FRAME_FORMAT APA102_FORMAT_APA102
+    #endif
+
+    #if APA102_FRAME_FORMAT == APA102_FORMAT_HD108
+
+        /**
+         * @def APA102_LED_FRAME_SIZE
+         * @brief Defines the size of a single LED data frame in bytes, depending on the selected `APA102_FRAME_FORMAT`.
+         */
+        #define APA102_LED_FRAME_SIZE 8
+
+        #ifndef APA102_FRAME_SIZE
+            #define APA102_FRAME_SIZE 16
+        #endif
+    #else
+        #define APA102_LED_FRAME_SIZE 4
+    #endif
+
     #ifndef APA102_FRAME_SIZE
         /**
          * @def APA102_FRAME_SIZE
-         * @brief Defines the size of the LED start/stop and data frame in bytes.
+         * @brief Defines the size of the LED start/stop frame in bytes.
          *
          * @details
-         * This macro indicates how many bytes make up a start/stop and data frame sent via SPI to the LED. The default frame size is 4 bytes.
+         * This macro indicates how many bytes make up a start/stop frame sent via SPI to the LED. The default frame size is 4 bytes (16 bytes for `APA102_FORMAT_HD108`). The size of a LED data frame is defined by the frame format (see `APA102_LED_FRAME_SIZE`).
          *
-         * @note Modify this value if the LED hardware protocol requires a different start/stop and data frame size.
+         * @note Modify this value if the LED hardware protocol requires a different start/stop frame size.
          */
         #define APA102_FRAME_SIZE 4
     #endif
 
+    #ifndef APA102_EOF_LENGTH
+        /**
+         * @def APA102_EOF_LENGTH
+         * @brief Defines the size of the end frame in bytes for a chain of `leds` LEDs.
+         *
+         * @details
+         * Every LED delays the data by half a clock, so the last LED of the chain needs `leds / 2` additional clocks after its frame. The default is the larger value of `APA102_FRAME_SIZE` and one byte per 16 LEDs. If `APA102_EOF_SIZE` is defined by the application, its value is used for every chain length.
+         */
+        #ifdef APA102_EOF_SIZE
+            #define APA102_EOF_LENGTH(leds) (APA102_EOF_SIZE)
+        #else
+            #define APA102_EOF_LENGTH(leds) ((APA102_FRAME_SIZE) > (((leds) + 15) / 16) ? (APA102_FRAME_SIZE) : (((leds) + 15) / 16))
+        #endif
+    #endif
+
+    #ifndef APA102_EOF_SIZE
+        /**
+         * @def APA102_EOF_SIZE
+         * @brief Defines the size of the end frame in bytes.
+         *
+         * @details
+         * The default is `APA102_EOF_LENGTH()` of `APA102_NUMBER_OF_LEDS`, the larger value of `APA102_FRAME_SIZE` and one byte per 16 LEDs.
+         */
+        #define APA102_EOF_SIZE APA102_EOF_LENGTH(APA102_NUMBER_OF_LEDS)
+    #endif
+
     #ifndef APA102_START_FLAG
         /**
          * @def APA102_START_FLAG
@@ -140,12 +212,345 @@
              */
             #define APA102_SLEEP_FLAG 0xA0
         #endif
+
+        #if APA102_FRAME_FORMAT != APA102_FORMAT_APA102
+            #error "APA102_POWER_SAVING_AVAILABLE is only supported by APA102_FORMAT_APA102"
+        #endif
+    #endif
+
+    #ifndef APA102_CORRECTION_AVAILABLE
+        /**
+         * @def APA102_CORRECTION_AVAILABLE
+         * @brief Flag enabling the colour-correction and white balance stage.
+         *
+         * @details
+         * This macro should be defined if every LED frame should pass through the colour correction stage (see apa102_correction.h) before it is sent via SPI. The calibration data is loaded at runtime with `apa102_correction_load()`. A diagonal matrix is folded into per-channel lookup tables, so the correction costs the same as sending the raw colour.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_correction.c` are compiled with the same configuration.
+         */
+        //#define APA102_CORRECTION_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_CORRECTION_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_CALIBRATION_AVAILABLE
+        /**
+         * @def APA102_CALIBRATION_AVAILABLE
+         * @brief Flag enabling the per-LED brightness calibration.
+         *
+         * @details
+         * This macro should be defined if every LED frame should be scaled with the gain of its position in the strip (see apa102_calibration.h). The position is counted from the last start-of-frame. The calibration is applied after the colour correction stage.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_calibration.c` are compiled with the same configuration.
+         */
+        //#define APA102_CALIBRATION_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_CALIBRATION_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_RECORDER_AVAILABLE
+        /**
+         * @def APA102_RECORDER_AVAILABLE
+         * @brief Flag enabling the recorder of the transmitted SPI byte stream.
+         *
+         * @details
+         * This macro should be defined if every byte sent via `spi_transfer()` should be teed into the frame recorder (see apa102_recorder.h). On Linux the bytes are written into a timestamped capture file, on microcontrollers they are kept in a RAM ring buffer.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_recorder.c` are compiled with the same configuration.
+         */
+        //#define APA102_RECORDER_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_RECORDER_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_BUS_AVAILABLE
+        /**
+         * @def APA102_BUS_AVAILABLE
+         * @brief Flag enabling the sharing of the SPI bus with other devices.
+         *
+         * @details
+         * This macro should be defined if the SPI bus is shared with other devices (see apa102_bus.h). Every LED data sequence from `APA102_SOF()` up to `APA102_EOF()` is sent as one locked transaction and the clock/data lines to the LED strip can be gated around it.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_bus.c` are compiled with the same configuration.
+         */
+        //#define APA102_BUS_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_BUS_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_TX_AVAILABLE
+        /**
+         * @def APA102_TX_AVAILABLE
+         * @brief Flag enabling the cooperative transmission of LED data sequences.
+         *
+         * @details
+         * This macro should be defined if LED data sequences should be sent in small steps from a cooperative superloop (see apa102_tx.h). Every call of `apa102_tx_poll()` sends at most a given number of bytes and returns, so long refreshes do not block other tasks.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_tx.c` are compiled with the same configuration.
+         */
+        //#define APA102_TX_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_TX_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_GATHER_AVAILABLE
+        /**
+         * @def APA102_GATHER_AVAILABLE
+         * @brief Flag enabling the scatter-gather transmission of LED data sequences.
+         *
+         * @details
+         * This macro should be defined if LED data sequences should be sent from a list of segments (constant start/end frame blocks and slices of encoded LED frames) without assembling them in a contiguous buffer (see apa102_gather.h).
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_gather.c` are compiled with the same configuration.
+         */
+        //#define APA102_GATHER_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_GATHER_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_RING_AVAILABLE
+        /**
+         * @def APA102_RING_AVAILABLE
+         * @brief Flag enabling the ring framebuffer with a rotation offset.
+         *
+         * @details
+         * This macro should be defined if a framebuffer of encoded LED frames should be scrolled by moving its start offset instead of the pixels (see apa102_ring.h). The framebuffer is sent with the scatter-gather transmission, so `APA102_GATHER_AVAILABLE` is required.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c`, `apa102_gather.c` and `apa102_ring.c` are compiled with the same configuration.
+         */
+        //#define APA102_RING_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_RING_AVAILABLE
+        #endif
+    #endif
+
+    #if defined(APA102_RING_AVAILABLE) && !defined(APA102_GATHER_AVAILABLE)
+        #error "APA102_RING_AVAILABLE requires APA102_GATHER_AVAILABLE"
+    #endif
+
+    #ifndef APA102_SEGMENT_AVAILABLE
+        /**
+         * @def APA102_SEGMENT_AVAILABLE
+         * @brief Flag enabling virtual segments (replicate, mirror, reverse and group) at transmit time.
+         *
+         * @details
+         * This macro should be defined if symmetric layouts should be rendered from their unique pixels only (see apa102_segment.h). A segment table maps slices of the source buffer onto the strip while the LED frames are sent.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_segment.c` are compiled with the same configuration.
+         */
+        //#define APA102_SEGMENT_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_SEGMENT_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_BLEND_AVAILABLE
+        /**
+         * @def APA102_BLEND_AVAILABLE
+         * @brief Flag enabling the crossfade of two color buffers while they are sent.
+         *
+         * @details
+         * This macro should be defined if scene transitions should blend two color buffers with a fixed-point mix factor during encoding (see apa102_blend.h), without a third buffer for the blended colors.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_blend.c` are compiled with the same configuration.
+         */
+        //#define APA102_BLEND_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_BLEND_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_MATRIX_AVAILABLE
+        /**
+         * @def APA102_MATRIX_AVAILABLE
+         * @brief Flag enabling the 2D mapping of LED matrices.
+         *
+         * @details
+         * This macro should be defined if a LED matrix should be rendered into a row-major framebuffer with `x`/`y` coordinates (see apa102_matrix.h). The mapping to the position on the strip (progressive or serpentine wiring, rows or columns, flipped axes) is resolved while the LED frames are sent.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_matrix.c` are compiled with the same configuration.
+         */
+        //#define APA102_MATRIX_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_MATRIX_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_DITHER_AVAILABLE
+        /**
+         * @def APA102_DITHER_AVAILABLE
+         * @brief Flag enabling the spatial dithering of dimmed framebuffers.
+         *
+         * @details
+         * This macro should be defined if a 2D framebuffer should be dimmed with ordered (Bayer) or Floyd-Steinberg dithering before it is encoded (see apa102_dither.h). The fraction lost by dimming is spread over neighbouring pixels, so dark gradients keep their levels.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_dither.c` are compiled with the same configuration.
+         */
+        //#define APA102_DITHER_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_DITHER_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_PLANAR_AVAILABLE
+        /**
+         * @def APA102_PLANAR_AVAILABLE
+         * @brief Flag enabling planar (structure-of-arrays) render buffers.
+         *
+         * @details
+         * This macro should be defined if effects render into separate red, green and blue planes (see apa102_planar.h). The planes are interleaved into LED frames by a vectorised encoder (SSE2/NEON on hosts, unrolled on microcontrollers).
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_planar.c` are compiled with the same configuration.
+         */
+        //#define APA102_PLANAR_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PLANAR_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_PIPELINE_AVAILABLE
+        /**
+         * @def APA102_PIPELINE_AVAILABLE
+         * @brief Flag enabling the fused pixel pipeline.
+         *
+         * @details
+         * This macro should be defined if gamma, white balance, master dimmer and power limiting should run in a single per-LED loop that writes the LED frames directly (see apa102_pipeline.h). The stages are selected with `APA102_PIPELINE_GAMMA`, `APA102_PIPELINE_WHITE`, `APA102_PIPELINE_DIMMER` and `APA102_PIPELINE_POWER`.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_pipeline.c` are compiled with the same configuration.
+         */
+        //#define APA102_PIPELINE_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PIPELINE_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_TEXT_AVAILABLE
+        /**
+         * @def APA102_TEXT_AVAILABLE
+         * @brief Flag enabling the bitmap font text renderer.
+         *
+         * @details
+         * This macro should be defined if text should be rendered with a bitmap font into a column buffer and scrolled over a LED matrix (see apa102_text.h). The text is sent through the matrix mapping, so `APA102_MATRIX_AVAILABLE` is required.
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c`, `apa102_matrix.c` and `apa102_text.c` are compiled with the same configuration.
+         */
+        //#define APA102_TEXT_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_TEXT_AVAILABLE
+        #endif
+    #endif
+
+    #if defined(APA102_TEXT_AVAILABLE) && !defined(APA102_MATRIX_AVAILABLE)
+        #error "APA102_TEXT_AVAILABLE requires APA102_MATRIX_AVAILABLE"
+    #endif
+
+    #ifndef APA102_PARTICLE_AVAILABLE
+        /**
+         * @def APA102_PARTICLE_AVAILABLE
+         * @brief Flag enabling the particle engine.
+         *
+         * @details
+         * This macro should be defined if particles (sparks, comets, fireworks) should be simulated in a static pool with fixed-point physics and added to a color buffer before it is sent (see apa102_particle.h).
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_particle.c` are compiled with the same configuration.
+         */
+        //#define APA102_PARTICLE_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PARTICLE_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_NOISE_AVAILABLE
+        /**
+         * @def APA102_NOISE_AVAILABLE
+         * @brief Flag enabling the fixed-point simplex noise.
+         *
+         * @details
+         * This macro should be defined if organic effects (fire, clouds, lava) should be calculated with one-, two- or three-dimensional simplex noise in fixed-point arithmetic (see apa102_noise.h).
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_noise.c` are compiled with the same configuration.
+         */
+        //#define APA102_NOISE_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_NOISE_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_PALETTE_AVAILABLE
+        /**
+         * @def APA102_PALETTE_AVAILABLE
+         * @brief Flag enabling the gradient palettes.
+         *
+         * @details
+         * This macro should be defined if gradients (color stops interpolated in RGB or Oklab) should be compiled into ramps of 256 LED frames that map a scalar field to colors with one lookup per LED (see apa102_palette.h).
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_palette.c` are compiled with the same configuration.
+         */
+        //#define APA102_PALETTE_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PALETTE_AVAILABLE
+        #endif
+    #endif
+
+    #ifndef APA102_SERIAL_AVAILABLE
+        /**
+         * @def APA102_SERIAL_AVAILABLE
+         * @brief Flag enabling the Adalight and TPM2 serial receiver.
+         *
+         * @details
+         * This macro should be defined if LED colors should be received from a PC over a UART (ambilight software) and sent to the strip byte by byte from the receive interrupt without a frame buffer (see apa102_serial.h).
+         *
+         * @note Set this macro as a global compiler symbol, so that `apa102.c` and `apa102_serial.c` are compiled with the same configuration.
+         */
+        //#define APA102_SERIAL_AVAILABLE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_SERIAL_AVAILABLE
+        #endif
+    #endif
+
+    #if defined(APA102_SERIAL_AVAILABLE) && defined(APA102_BUS_AVAILABLE)
+        #error "APA102_SERIAL_AVAILABLE sends from an interrupt and cannot wait for the lock of APA102_BUS_AVAILABLE"
     #endif
 
     #include "../../../core_types/gfx/color.h"
     #include "../../../utils/macros/stringify.h"
 
-    #include _STR(../../../hal/APA102_HAL_PLATFORM/spi/spi.h)
+    #ifndef APA102_HAL_SPI
+        /**
+         * @def APA102_HAL_SPI
+         * @brief Header of the SPI hardware abstraction layer.
+         *
+         * @details
+         * The header is derived from `APA102_HAL_PLATFORM`. Define this macro with a quoted path to use a different SPI implementation (e.g. the host shim of the tools in `tools/host/spi.h`).
+         */
+        #define APA102_HAL_SPI _STR(../../../hal/APA102_HAL_PLATFORM/spi/spi.h)
+    #endif
+
+    #include APA102_HAL_SPI
 
     /**
      * @enum APA102_Transmission_t
@@ -184,7 +589,11 @@
     #define APA102_EOF() { apa102_xof(APA102_Transmission_EOF); }
 
     void apa102_init(void);
+    void apa102_encode(unsigned int led, unsigned char flag, const GFX_RGBA_Color *color, unsigned char *frame);
+    void apa102_sequence_begin(void);
+    void apa102_sequence_end(void);
     void apa102_xof(APA102_Transmission type);
+    void apa102_write(const unsigned char *data, unsigned int length);
     void apa102_led(const GFX_RGBA_Color *color);
     void apa102_leds(const GFX_RGBA_Color *color);
     void apa102_led_off(void);
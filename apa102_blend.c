@@ -0,0 +1,75 @@
+/**
+ * @file apa102_blend.c
+ * @brief Implementation of the crossfade of two color buffers at encode time.
+ *
+ * This source file implements the fixed-point blend of two colors and the transmission of two blended color buffers as one LED data sequence.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_blend.h"
+
+#ifdef APA102_BLEND_AVAILABLE
+
+    static unsigned char apa102_blend_channel(unsigned char from, unsigned char to, unsigned int weight)
+    {
+        return (unsigned char)((((unsigned int)from * (256U - weight)) + ((unsigned int)to * weight)) >> 8);
+    }
+
+    /**
+     * @brief Blend two colors with a fixed-point mix factor.
+     *
+     * @param from Pointer to the first color.
+     * @param to Pointer to the second color.
+     * @param mix Mix factor from `APA102_BLEND_FROM` (first color) up to `APA102_BLEND_TO` (second color).
+     * @param result Pointer where the blended color is stored.
+     *
+     * @details
+     * The mix factor is extended to a weight of `0..256`, so both ends return the source colors exactly. All channels including the intensity are blended, the products fit into 16 bits.
+     */
+    void apa102_blend_color(const GFX_RGBA_Color *from, const GFX_RGBA_Color *to, unsigned char mix, GFX_RGBA_Color *result)
+    {
+        unsigned int weight = (unsigned int)mix + (mix >> 7);
+
+        result->alpha = apa102_blend_channel(from->alpha, to->alpha, weight);
+        result->red = apa102_blend_channel(from->red, to->red, weight);
+        result->green = apa102_blend_channel(from->green, to->green, weight);
+        result->blue = apa102_blend_channel(from->blue, to->blue, weight);
+    }
+
+    /**
+     * @brief Transmit the crossfade of two color buffers.
+     *
+     * @param from Pointer to the first color buffer.
+     * @param to Pointer to the second color buffer.
+     * @param leds Number of LEDs in both buffers.
+     * @param mix Mix factor from `APA102_BLEND_FROM` (first buffer) up to `APA102_BLEND_TO` (second buffer).
+     *
+     * @details
+     * The function sends a complete LED data sequence. Every LED is blended with `apa102_blend_color()` right before its LED frame is sent with `apa102_led()`, the blended colors are not stored.
+     */
+    void apa102_blend(const GFX_RGBA_Color *from, const GFX_RGBA_Color *to, unsigned int leds, unsigned char mix)
+    {
+        APA102_SOF();
+
+        for (unsigned int i=0; i < leds; i++)
+        {
+            GFX_RGBA_Color color;
+
+            apa102_blend_color(&from[i], &to[i], mix, &color);
+            apa102_led(&color);
+        }
+
+        APA102_EOF();
+    }
+
+#endif
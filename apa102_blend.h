@@ -0,0 +1,39 @@
+/**
+ * @file apa102_blend.h
+ * @brief Crossfade of two color buffers at encode time for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional crossfade. Two source buffers are blended with an 8-bit fixed-point mix factor while the LED frames are encoded and sent. A scene transition so needs no buffer for the blended colors, and the blend of a LED runs while the previous LED frame is shifted out.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_BLEND_H_
+#define APA102_BLEND_H_
+
+    #include "apa102.h"
+
+    /**
+     * @def APA102_BLEND_FROM
+     * @brief Mix factor that shows the first buffer only.
+     */
+    #define APA102_BLEND_FROM 0x00
+
+    /**
+     * @def APA102_BLEND_TO
+     * @brief Mix factor that shows the second buffer only.
+     */
+    #define APA102_BLEND_TO 0xFF
+
+    void apa102_blend_color(const GFX_RGBA_Color *from, const GFX_RGBA_Color *to, unsigned char mix, GFX_RGBA_Color *result);
+    void apa102_blend(const GFX_RGBA_Color *from, const GFX_RGBA_Color *to, unsigned int leds, unsigned char mix);
+
+#endif /* APA102_BLEND_H_ */
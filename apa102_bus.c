@@ -0,0 +1,173 @@
+/**
+ * @file apa102_bus.c
+ * @brief Implementation of the SPI bus sharing support.
+ *
+ * This source file implements the bus lock shared by all devices on the SPI bus and the LED transaction that is wrapped around every LED data sequence by the driver (`apa102_bus_begin()` on start-of-frame, `apa102_bus_end()` after end-of-frame).
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_bus.h"
+
+#ifdef APA102_BUS_AVAILABLE
+
+    static volatile unsigned char apa102_bus_locked;
+    static unsigned char apa102_bus_active;
+    static APA102_Bus_Hooks apa102_bus_hooks;
+    static APA102_Bus_Stats apa102_bus_statistics;
+    static unsigned long apa102_bus_start;
+
+    /**
+     * @brief Register the hooks of the bus sharing support.
+     *
+     * @param hooks Pointer to the hooks, the structure is copied. Passing `0` removes all hooks.
+     *
+     * @note Call this function before the first LED data sequence, e.g. after `spi_init()` and before `apa102_init()`.
+     */
+    void apa102_bus_init(const APA102_Bus_Hooks *hooks)
+    {
+        if (hooks)
+        {
+            apa102_bus_hooks = *hooks;
+        }
+        else
+        {
+            apa102_bus_hooks = (APA102_Bus_Hooks){ 0, 0, 0, 0 };
+        }
+    }
+
+    /**
+     * @brief Try to lock the shared SPI bus.
+     *
+     * @return `APA102_Bus_Ok` if the lock was taken, `APA102_Bus_Busy` if another device holds the bus.
+     *
+     * @details
+     * Every device on the shared bus has to lock it before its `spi_transfer()` calls and unlock it with `apa102_bus_unlock()` afterwards. The lock is taken atomically, so it can also be used from interrupts (the interrupt must not wait for the lock).
+     */
+    APA102_Bus_Status apa102_bus_lock(void)
+    {
+        APA102_Bus_Status status = APA102_Bus_Busy;
+
+        APA102_BUS_ATOMIC_BEGIN();
+
+        if (!apa102_bus_locked)
+        {
+            apa102_bus_locked = 1;
+            status = APA102_Bus_Ok;
+        }
+
+        APA102_BUS_ATOMIC_END();
+
+        return status;
+    }
+
+    /**
+     * @brief Release the shared SPI bus.
+     */
+    void apa102_bus_unlock(void)
+    {
+        apa102_bus_locked = 0;
+    }
+
+    /**
+     * @brief Start a LED transaction (called on every start-of-frame).
+     *
+     * @details
+     * The function waits until the bus lock is available, enables the gate of the clock/data lines and starts the hold time measurement. A start-of-frame inside a running transaction does not lock the bus again.
+     */
+    void apa102_bus_begin(void)
+    {
+        if (apa102_bus_active)
+        {
+            return;
+        }
+
+        if (apa102_bus_lock() != APA102_Bus_Ok)
+        {
+            apa102_bus_statistics.contentions++;
+
+            while (apa102_bus_lock() != APA102_Bus_Ok)
+            {
+                if (apa102_bus_hooks.wait)
+                {
+                    apa102_bus_hooks.wait();
+                }
+            }
+        }
+        apa102_bus_active = 1;
+
+        if (apa102_bus_hooks.timestamp)
+        {
+            apa102_bus_start = apa102_bus_hooks.timestamp();
+        }
+        if (apa102_bus_hooks.gate_enable)
+        {
+            apa102_bus_hooks.gate_enable();
+        }
+    }
+
+    /**
+     * @brief Finish a LED transaction (called after every end-of-frame).
+     *
+     * @details
+     * The gate of the clock/data lines is disabled, the hold time is added to the statistics and the bus is released.
+     */
+    void apa102_bus_end(void)
+    {
+        unsigned long hold = 0;
+
+        if (!apa102_bus_active)
+        {
+            return;
+        }
+
+        if (apa102_bus_hooks.gate_disable)
+        {
+            apa102_bus_hooks.gate_disable();
+        }
+        if (apa102_bus_hooks.timestamp)
+        {
+            hold = apa102_bus_hooks.timestamp() - apa102_bus_start;
+        }
+
+        apa102_bus_statistics.transactions++;
+        apa102_bus_statistics.hold_last = hold;
+        apa102_bus_statistics.hold_total += hold;
+
+        if (hold > apa102_bus_statistics.hold_max)
+        {
+            apa102_bus_statistics.hold_max = hold;
+        }
+
+        apa102_bus_active = 0;
+        apa102_bus_unlock();
+    }
+
+    /**
+     * @brief Read the statistics of the LED transactions.
+     *
+     * @param stats Pointer where the statistics are copied to.
+     */
+    void apa102_bus_stats(APA102_Bus_Stats *stats)
+    {
+        *stats = apa102_bus_statistics;
+    }
+
+    /**
+     * @brief Reset the statistics of the LED transactions.
+     */
+    void apa102_bus_stats_reset(void)
+    {
+        apa102_bus_statistics = (APA102_Bus_Stats){ 0, 0, 0, 0, 0 };
+    }
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file apa102_bus.h
+ * @brief SPI bus sharing support for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional bus sharing support. The APA102 has no chip select, every byte on the shared SPI bus is taken as LED data. With this feature every LED data sequence (`APA102_SOF()` up to `APA102_EOF()`) is sent as one locked transaction and the clock/data lines can be gated (e.g. with a 74HC125 buffer) around it. Other devices on the bus use the same lock, so their transfers are never interleaved with LED frames.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_BUS_H_
+#define APA102_BUS_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_BUS_ATOMIC_BEGIN
+        /**
+         * @def APA102_BUS_ATOMIC_BEGIN
+         * @brief Starts a section that cannot be interrupted while the bus lock is taken or released.
+         *
+         * @details
+         * On AVR the global interrupt flag is saved and cleared. Define this macro together with `APA102_BUS_ATOMIC_END` for other platforms if SPI devices are accessed from interrupts.
+         */
+        #if defined(__AVR__)
+            #include <avr/io.h>
+            #include <avr/interrupt.h>
+
+            #define APA102_BUS_ATOMIC_BEGIN() unsigned char apa102_bus_sreg = SREG; cli()
+        #else
+            #define APA102_BUS_ATOMIC_BEGIN()
+        #endif
+    #endif
+
+    #ifndef APA102_BUS_ATOMIC_END
+        /**
+         * @def APA102_BUS_ATOMIC_END
+         * @brief Ends a section started with `APA102_BUS_ATOMIC_BEGIN`.
+         */
+        #if defined(__AVR__)
+            #define APA102_BUS_ATOMIC_END() SREG = apa102_bus_sreg
+        #else
+            #define APA102_BUS_ATOMIC_END()
+        #endif
+    #endif
+
+    /**
+     * @def APA102_BUS_RAM
+     * @brief Static RAM in bytes used by the bus sharing support (lock, hooks and statistics).
+     */
+    #define APA102_BUS_RAM ((2 * sizeof(unsigned char)) + sizeof(APA102_Bus_Hooks) + sizeof(APA102_Bus_Stats) + sizeof(unsigned long))
+
+    /**
+     * @enum APA102_Bus_Status_t
+     * @brief Enumerates the results of the bus lock.
+     */
+    enum APA102_Bus_Status_t
+    {
+        APA102_Bus_Ok=0,
+        APA102_Bus_Busy
+    };
+    /**
+     * @typedef APA102_Bus_Status
+     * @brief Alias for enum APA102_Bus_Status_t representing the result of the bus lock.
+     */
+    typedef enum APA102_Bus_Status_t APA102_Bus_Status;
+
+    /**
+     * @struct APA102_Bus_Hooks_t
+     * @brief Functions called around a LED data sequence, every entry may be `0`.
+     *
+     * @details
+     * `gate_enable` connects the clock/data lines to the LED strip after the bus was locked, `gate_disable` disconnects them before the bus is released. `timestamp` returns a free running time (e.g. timer ticks or microseconds) used to measure the bus lock hold time, `wait` is called while another device holds the bus.
+     */
+    struct APA102_Bus_Hooks_t
+    {
+        void (*gate_enable)(void);
+        void (*gate_disable)(void);
+        unsigned long (*timestamp)(void);
+        void (*wait)(void);
+    };
+    /**
+     * @typedef APA102_Bus_Hooks
+     * @brief Alias for struct APA102_Bus_Hooks_t representing the hooks of the bus sharing support.
+     */
+    typedef struct APA102_Bus_Hooks_t APA102_Bus_Hooks;
+
+    /**
+     * @struct APA102_Bus_Stats_t
+     * @brief Statistics of the LED transactions on the shared bus.
+     *
+     * @details
+     * Hold times are measured in the unit of the `timestamp` hook and stay `0` without it.
+     */
+    struct APA102_Bus_Stats_t
+    {
+        unsigned long transactions;     /**< Completed LED data sequences. */
+        unsigned long contentions;      /**< Sequences that had to wait for another device. */
+        unsigned long hold_last;        /**< Bus lock hold time of the last sequence. */
+        unsigned long hold_max;         /**< Longest bus lock hold time. */
+        unsigned long hold_total;       /**< Sum of all bus lock hold times. */
+    };
+    /**
+     * @typedef APA102_Bus_Stats
+     * @brief Alias for struct APA102_Bus_Stats_t representing the statistics of the LED transactions.
+     */
+    typedef struct APA102_Bus_Stats_t APA102_Bus_Stats;
+
+    void apa102_bus_init(const APA102_Bus_Hooks *hooks);
+    APA102_Bus_Status apa102_bus_lock(void);
+    void apa102_bus_unlock(void);
+    void apa102_bus_begin(void);
+    void apa102_bus_end(void);
+    void apa102_bus_stats(APA102_Bus_Stats *stats);
+    void apa102_bus_stats_reset(void);
+
+#endif /* APA102_BUS_H_ */
@@ -0,0 +1,105 @@
+/**
+ * @file apa102_calibration.c
+ * @brief Implementation of the per-LED brightness calibration.
+ *
+ * This source file decodes the packed 4-bit deltas of the loaded calibration table and scales the colour channels of every LED frame with the resulting gain. The gain is applied with a multiplication and a shift, no division is required.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_calibration.h"
+
+#ifdef APA102_CALIBRATION_AVAILABLE
+
+    static const APA102_Calibration *apa102_calibration;
+
+    static unsigned char apa102_calibration_channel(unsigned int nibble, unsigned char gain, unsigned char value)
+    {
+        unsigned char packed = APA102_CALIBRATION_READ(&apa102_calibration->delta[nibble >> 1]);
+        signed char delta = (signed char)((nibble & 0x01) ? (packed >> 4) : (packed & 0x0F));
+        signed int factor;
+
+        if (delta & 0x08)
+        {
+            delta -= 0x10;
+        }
+        factor = (signed int)gain + 1 + (delta * APA102_CALIBRATION_STEP);
+
+        if (factor <= 0)
+        {
+            return 0x00;
+        }
+        else if (factor >= 256)
+        {
+            return value;
+        }
+        return (unsigned char)(((unsigned int)value * (unsigned int)factor) >> 8);
+    }
+
+    /**
+     * @brief Load the per-LED calibration table of the connected LED strip.
+     *
+     * @param calibration Pointer to the calibration table. The table is referenced, not copied, and has to stay valid while the stage is active.
+     *
+     * @details
+     * The calibration is applied to every following LED frame. The position of a LED is counted from the last start-of-frame (`SOF`).
+     */
+    void apa102_calibration_load(const APA102_Calibration *calibration)
+    {
+        apa102_calibration = calibration;
+    }
+
+    /**
+     * @brief Disable the per-LED calibration stage.
+     */
+    void apa102_calibration_reset(void)
+    {
+        apa102_calibration = 0;
+    }
+
+    /**
+     * @brief Apply the per-LED calibration to a colour.
+     *
+     * @param led Position of the LED in the strip, starting with `0` after the start-of-frame.
+     * @param color Pointer to the colour that should be calibrated.
+     * @param result Pointer where the calibrated colour is stored. The intensity (`alpha`) is copied unchanged.
+     *
+     * @details
+     * The gain of every channel is the batch average plus the signed delta of the LED multiplied by `APA102_CALIBRATION_STEP`. Gains are limited to `1.0`, so a LED can only be dimmed towards the uniform level.
+     */
+    void apa102_calibration_apply(unsigned int led, const GFX_RGBA_Color *color, GFX_RGBA_Color *result)
+    {
+        result->alpha = color->alpha;
+
+        if (!apa102_calibration)
+        {
+            result->red = color->red;
+            result->green = color->green;
+            result->blue = color->blue;
+        }
+        else if (led >= apa102_calibration->leds)
+        {
+            result->red = (unsigned char)(((unsigned int)color->red * (apa102_calibration->gain[0] + 1U)) >> 8);
+            result->green = (unsigned char)(((unsigned int)color->green * (apa102_calibration->gain[1] + 1U)) >> 8);
+            result->blue = (unsigned char)(((unsigned int)color->blue * (apa102_calibration->gain[2] + 1U)) >> 8);
+        }
+        else
+        {
+            unsigned int nibble = led * 3;
+
+            result->red = apa102_calibration_channel(nibble, apa102_calibration->gain[0], color->red);
+            result->green = apa102_calibration_channel(nibble + 1, apa102_calibration->gain[1], color->green);
+            result->blue = apa102_calibration_channel(nibble + 2, apa102_calibration->gain[2], color->blue);
+        }
+    }
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @file apa102_calibration.h
+ * @brief Per-LED brightness calibration for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional per-LED calibration stage. Every LED of a strip gets its own gain correction, stored as compact 4-bit deltas per channel against the average gain of the LED batch. The table is generated on the host from measurement data (see `tools/calibration`) and can be placed in flash or EEPROM.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_CALIBRATION_H_
+#define APA102_CALIBRATION_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_CALIBRATION_STEP
+        /**
+         * @def APA102_CALIBRATION_STEP
+         * @brief Defines the gain change of a single delta step.
+         *
+         * @details
+         * Gains are fixed-point values where `256` equals `1.0`. With the default step of `4` a delta of `-8..7` covers a deviation of about `-12.5%..+11%` from the batch average.
+         *
+         * @note The value has to match the step used by the host tool that generated the calibration table.
+         */
+        #define APA102_CALIBRATION_STEP 4
+    #endif
+
+    #ifndef APA102_CALIBRATION_READ
+        /**
+         * @def APA102_CALIBRATION_READ
+         * @brief Reads a single byte of the calibration table.
+         *
+         * @details
+         * On platforms with memory mapped flash (e.g. avr0) the table can be accessed directly. Redefine this macro (e.g. with `pgm_read_byte`) if the table is located in a separate address space.
+         */
+        #define APA102_CALIBRATION_READ(address) (*(address))
+    #endif
+
+    /**
+     * @def APA102_CALIBRATION_RAM
+     * @brief Static RAM in bytes used by the per-LED calibration (table reference and LED position).
+     *
+     * @note The calibration table itself is not included, it is provided by the application (usually located in flash).
+     */
+    #define APA102_CALIBRATION_RAM (sizeof(void *) + sizeof(unsigned int))
+
+    /**
+     * @struct APA102_Calibration_t
+     * @brief Per-LED calibration table of a LED strip.
+     *
+     * @details
+     * The `gain` holds the batch average gain of the red, green and blue channel (`0xFF` equals `1.0`). The `delta` table holds three signed 4-bit values (red, green, blue) per LED. The nibbles are packed consecutively starting with the low nibble, so a LED takes 1.5 bytes. LEDs beyond `leds` use the batch average only.
+     */
+    struct APA102_Calibration_t
+    {
+        unsigned char gain[3];
+        const unsigned char *delta;
+        unsigned int leds;
+    };
+    /**
+     * @typedef APA102_Calibration
+     * @brief Alias for struct APA102_Calibration_t representing the per-LED calibration table of a LED strip.
+     */
+    typedef struct APA102_Calibration_t APA102_Calibration;
+
+    void apa102_calibration_load(const APA102_Calibration *calibration);
+    void apa102_calibration_reset(void);
+    void apa102_calibration_apply(unsigned int led, const GFX_RGBA_Color *color, GFX_RGBA_Color *result);
+
+#endif /* APA102_CALIBRATION_H_ */
@@ -0,0 +1,164 @@
+/**
+ * @file apa102_correction.c
+ * @brief Implementation of the colour-correction and white balance stage.
+ *
+ * This source file folds the loaded correction matrix and white point into either three per-channel lookup tables (diagonal matrix) or a combined fixed-point matrix (full matrix). The selected representation is applied to every LED frame before it is sent via SPI.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_correction.h"
+
+#ifdef APA102_CORRECTION_AVAILABLE
+
+    enum APA102_Correction_Mode_t
+    {
+        APA102_Correction_Mode_Bypass=0,
+        APA102_Correction_Mode_Table,
+        APA102_Correction_Mode_Matrix
+    };
+    typedef enum APA102_Correction_Mode_t APA102_Correction_Mode;
+
+    static APA102_Correction_Mode apa102_correction_mode = APA102_Correction_Mode_Bypass;
+    static signed int apa102_correction_matrix[3][3];
+    static unsigned char apa102_correction_table[3][256];
+
+    static unsigned char apa102_correction_clamp(signed long value)
+    {
+        if (value < 0)
+        {
+            return 0x00;
+        }
+        else if (value > 0xFF)
+        {
+            return 0xFF;
+        }
+        return (unsigned char)value;
+    }
+
+    /**
+     * @brief Load the calibration data of the connected LED strip.
+     *
+     * @param correction Pointer to the correction matrix and white point that should be used for all following LED frames.
+     *
+     * @details
+     * The white point is folded into the rows of the matrix, so the stage costs one pass per LED frame. If the resulting matrix is diagonal, it is further folded into three lookup tables with 256 entries each, which makes the correction as cheap as copying the colour. Otherwise the full matrix is evaluated for every LED frame. An identity matrix with a white point of `0xFF` on every channel disables the stage.
+     *
+     * @note The calibration data can be read from any source (e.g. EEPROM, flash or a host interface) before calling this function. It can be reloaded at any time between two LED data sequences.
+     */
+    void apa102_correction_load(const APA102_Correction *correction)
+    {
+        unsigned char diagonal = 1;
+        unsigned char identity = 1;
+
+        for (unsigned char row=0; row < 3; row++)
+        {
+            for (unsigned char column=0; column < 3; column++)
+            {
+                signed long coefficient = ((signed long)correction->matrix[row][column] * (correction->white[row] + 1)) >> 8;
+                apa102_correction_matrix[row][column] = (signed int)coefficient;
+
+                if (row != column && coefficient != 0)
+                {
+                    diagonal = 0;
+                }
+                if (coefficient != ((row == column) ? APA102_CORRECTION_ONE : 0))
+                {
+                    identity = 0;
+                }
+            }
+        }
+
+        if (identity)
+        {
+            apa102_correction_mode = APA102_Correction_Mode_Bypass;
+        }
+        else if (diagonal)
+        {
+            for (unsigned char channel=0; channel < 3; channel++)
+            {
+                signed long coefficient = apa102_correction_matrix[channel][channel];
+                unsigned int value = 0;
+
+                do
+                {
+                    apa102_correction_table[channel][value] = apa102_correction_clamp((coefficient * value) >> APA102_CORRECTION_SHIFT);
+                } while (++value < 256);
+            }
+            apa102_correction_mode = APA102_Correction_Mode_Table;
+        }
+        else
+        {
+            apa102_correction_mode = APA102_Correction_Mode_Matrix;
+        }
+    }
+
+    /**
+     * @brief Disable the colour correction stage.
+     *
+     * @details
+     * All following LED frames are sent with the uncorrected colour values.
+     */
+    void apa102_correction_reset(void)
+    {
+        apa102_correction_mode = APA102_Correction_Mode_Bypass;
+    }
+
+    /**
+     * @brief Apply the loaded colour correction to a colour.
+     *
+     * @param color Pointer to the colour that should be corrected.
+     * @param result Pointer where the corrected colour is stored. The intensity (`alpha`) is copied unchanged.
+     *
+     * @details
+     * Depending on the loaded calibration data the colour is either copied, mapped through the per-channel lookup tables or multiplied with the fixed-point matrix. Results are clamped to the valid range of a colour channel.
+     */
+    void apa102_correction_apply(const GFX_RGBA_Color *color, GFX_RGBA_Color *result)
+    {
+        result->alpha = color->alpha;
+
+        switch (apa102_correction_mode)
+        {
+            case APA102_Correction_Mode_Table:
+                result->red = apa102_correction_table[APA102_Correction_Red][color->red];
+                result->green = apa102_correction_table[APA102_Correction_Green][color->green];
+                result->blue = apa102_correction_table[APA102_Correction_Blue][color->blue];
+                break;
+
+            case APA102_Correction_Mode_Matrix:
+            {
+                unsigned char input[3] = { color->red, color->green, color->blue };
+                unsigned char output[3];
+
+                for (unsigned char row=0; row < 3; row++)
+                {
+                    signed long value = (signed long)apa102_correction_matrix[row][APA102_Correction_Red] * input[APA102_Correction_Red]
+                                      + (signed long)apa102_correction_matrix[row][APA102_Correction_Green] * input[APA102_Correction_Green]
+                                      + (signed long)apa102_correction_matrix[row][APA102_Correction_Blue] * input[APA102_Correction_Blue];
+
+                    output[row] = apa102_correction_clamp(value >> APA102_CORRECTION_SHIFT);
+                }
+                result->red = output[APA102_Correction_Red];
+                result->green = output[APA102_Correction_Green];
+                result->blue = output[APA102_Correction_Blue];
+                break;
+            }
+
+            default:
+                result->red = color->red;
+                result->green = color->green;
+                result->blue = color->blue;
+                break;
+        }
+    }
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * @file apa102_correction.h
+ * @brief Colour-correction matrix and white balance stage for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional colour-correction stage. A 3x3 fixed-point matrix together with a white point scaling can be loaded at runtime (e.g. from EEPROM) to compensate the colour cast of a specific LED batch. The correction is applied in a single pass while the LED frame is encoded.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_CORRECTION_H_
+#define APA102_CORRECTION_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_CORRECTION_SHIFT
+        /**
+         * @def APA102_CORRECTION_SHIFT
+         * @brief Defines the number of fractional bits of the correction matrix coefficients.
+         *
+         * @details
+         * The coefficients of the correction matrix are fixed-point values. With the default of `8` fractional bits a coefficient of `256` equals a gain of `1.0`.
+         */
+        #define APA102_CORRECTION_SHIFT 8
+    #endif
+
+    /**
+     * @def APA102_CORRECTION_ONE
+     * @brief Fixed-point representation of a gain of `1.0` in the correction matrix.
+     */
+    #define APA102_CORRECTION_ONE (1 << APA102_CORRECTION_SHIFT)
+
+    /**
+     * @def APA102_CORRECTION_RAM
+     * @brief Static RAM in bytes used by the colour-correction stage (lookup tables, combined matrix and mode).
+     */
+    #define APA102_CORRECTION_RAM (sizeof(unsigned char[3][256]) + sizeof(signed int[3][3]) + sizeof(int))
+
+    /**
+     * @enum APA102_Correction_Channel_t
+     * @brief Enumerates the colour channels used to index the correction matrix and white point.
+     */
+    enum APA102_Correction_Channel_t
+    {
+        APA102_Correction_Red=0,
+        APA102_Correction_Green,
+        APA102_Correction_Blue
+    };
+    /**
+     * @typedef APA102_Correction_Channel
+     * @brief Alias for enum APA102_Correction_Channel_t representing the colour channels of the correction stage.
+     */
+    typedef enum APA102_Correction_Channel_t APA102_Correction_Channel;
+
+    /**
+     * @struct APA102_Correction_t
+     * @brief Calibration data of a LED strip.
+     *
+     * @details
+     * The `matrix` is indexed `[output][input]` with the channels of `APA102_Correction_Channel` and holds fixed-point coefficients with `APA102_CORRECTION_SHIFT` fractional bits. The `white` point scales every output channel where `0xFF` leaves the channel unchanged.
+     */
+    struct APA102_Correction_t
+    {
+        signed int matrix[3][3];
+        unsigned char white[3];
+    };
+    /**
+     * @typedef APA102_Correction
+     * @brief Alias for struct APA102_Correction_t representing the calibration data of a LED strip.
+     */
+    typedef struct APA102_Correction_t APA102_Correction;
+
+    void apa102_correction_load(const APA102_Correction *correction);
+    void apa102_correction_reset(void);
+    void apa102_correction_apply(const GFX_RGBA_Color *color, GFX_RGBA_Color *result);
+
+#endif /* APA102_CORRECTION_H_ */
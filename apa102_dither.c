@@ -0,0 +1,163 @@
+/**
+ * @file apa102_dither.c
+ * @brief Implementation of the spatial dithering of dimmed framebuffers.
+ *
+ * This source file implements the dimming of a 2D framebuffer with ordered (Bayer) and Floyd-Steinberg dithering. Every channel is scaled to 16-bit fixed point (8 integer and 8 fractional bits), the dithering decides how the fraction is rounded.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_dither.h"
+
+#ifdef APA102_DITHER_AVAILABLE
+
+    /* 8x8 Bayer matrix scaled to thresholds of 0..255 (4 * b + 2) */
+    static const unsigned char apa102_dither_bayer[8][8] = {
+        {   2, 130,  34, 162,  10, 138,  42, 170 },
+        { 194,  66, 226,  98, 202,  74, 234, 106 },
+        {  50, 178,  18, 146,  58, 186,  26, 154 },
+        { 242, 114, 210,  82, 250, 122, 218,  90 },
+        {  14, 142,  46, 174,   6, 134,  38, 166 },
+        { 206,  78, 238, 110, 198,  70, 230, 102 },
+        {  62, 190,  30, 158,  54, 182,  22, 150 },
+        { 254, 126, 222,  94, 246, 118, 214,  86 }
+    };
+
+    #if APA102_DITHER_WIDTH > 0
+        static signed int apa102_dither_error[2][APA102_DITHER_WIDTH + 2][3];
+    #endif
+
+    static void apa102_dither_ordered(GFX_RGBA_Color *pixels, unsigned int width, unsigned int height, unsigned int weight)
+    {
+        for (unsigned int y=0; y < height; y++)
+        {
+            const unsigned char *threshold = apa102_dither_bayer[y & 0x07];
+
+            for (unsigned int x=0; x < width; x++)
+            {
+                unsigned int offset = threshold[x & 0x07];
+
+                pixels->red = (unsigned char)((((unsigned int)pixels->red * weight) + offset) >> 8);
+                pixels->green = (unsigned char)((((unsigned int)pixels->green * weight) + offset) >> 8);
+                pixels->blue = (unsigned char)((((unsigned int)pixels->blue * weight) + offset) >> 8);
+                pixels++;
+            }
+        }
+    }
+
+    #if APA102_DITHER_WIDTH > 0
+
+        static unsigned char apa102_dither_diffuse(unsigned char value, unsigned int weight, signed int *current, signed int *next, unsigned char channel)
+        {
+            signed long level = ((signed long)value * weight) + current[channel];
+            signed long result = (level + 128) >> 8;
+
+            if (result < 0)
+            {
+                result = 0;
+            }
+            else if (result > 255)
+            {
+                result = 255;
+            }
+
+            signed int error = (signed int)(level - (result << 8));
+
+            current[3 + channel] += (error * 7) / 16;
+            next[channel - 3] += (error * 3) / 16;
+            next[channel] += (error * 5) / 16;
+            next[3 + channel] += error / 16;
+
+            return (unsigned char)result;
+        }
+
+        static void apa102_dither_floyd_steinberg(GFX_RGBA_Color *pixels, unsigned int width, unsigned int height, unsigned int weight)
+        {
+            unsigned char row = 0;
+
+            for (unsigned int x=0; x < (width + 2); x++)
+            {
+                for (unsigned char channel=0; channel < 3; channel++)
+                {
+                    apa102_dither_error[0][x][channel] = 0;
+                    apa102_dither_error[1][x][channel] = 0;
+                }
+            }
+
+            for (unsigned int y=0; y < height; y++)
+            {
+                signed int *current = apa102_dither_error[row][1];
+                signed int *next = apa102_dither_error[row ^ 0x01][1];
+
+                for (unsigned int x=0; x < width; x++)
+                {
+                    pixels->red = apa102_dither_diffuse(pixels->red, weight, current, next, 0);
+                    pixels->green = apa102_dither_diffuse(pixels->green, weight, current, next, 1);
+                    pixels->blue = apa102_dither_diffuse(pixels->blue, weight, current, next, 2);
+
+                    current[0] = 0;
+                    current[1] = 0;
+                    current[2] = 0;
+
+                    current += 3;
+                    next += 3;
+                    pixels++;
+                }
+
+                for (unsigned char channel=0; channel < 3; channel++)
+                {
+                    current[channel] = 0;
+                    apa102_dither_error[row][0][channel] = 0;
+                }
+                row ^= 0x01;
+            }
+        }
+    #endif
+
+    /**
+     * @brief Dim a 2D framebuffer with dithering.
+     *
+     * @param pixels Pointer to the row-major framebuffer with `width * height` colors, dimmed in place.
+     * @param width Width of the framebuffer in pixels.
+     * @param height Height of the framebuffer in pixels.
+     * @param scale Brightness of the red, green and blue channel, `0xFF` leaves the colors unchanged.
+     * @param mode Dithering mode.
+     *
+     * @details
+     * The pass runs before the framebuffer is encoded (e.g. with `apa102_matrix_show()`). The intensity (alpha) of the pixels is not changed. The ordered mode only needs 16-bit arithmetic and a table lookup per channel. The Floyd-Steinberg mode falls back to the ordered mode if `width` exceeds `APA102_DITHER_WIDTH`.
+     */
+    void apa102_dither(GFX_RGBA_Color *pixels, unsigned int width, unsigned int height, unsigned char scale, APA102_Dither_Mode mode)
+    {
+        unsigned int weight = (unsigned int)scale + (scale >> 7);
+
+        #if APA102_DITHER_WIDTH > 0
+            if ((mode == APA102_Dither_FloydSteinberg) && (width <= APA102_DITHER_WIDTH))
+            {
+                apa102_dither_floyd_steinberg(pixels, width, height, weight);
+                return;
+            }
+        #endif
+
+        if (mode == APA102_Dither_None)
+        {
+            for (unsigned long i=0; i < ((unsigned long)width * height); i++)
+            {
+                pixels[i].red = (unsigned char)(((unsigned int)pixels[i].red * weight) >> 8);
+                pixels[i].green = (unsigned char)(((unsigned int)pixels[i].green * weight) >> 8);
+                pixels[i].blue = (unsigned char)(((unsigned int)pixels[i].blue * weight) >> 8);
+            }
+            return;
+        }
+        apa102_dither_ordered(pixels, width, height, weight);
+    }
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file apa102_dither.h
+ * @brief Spatial dithering of dimmed framebuffers for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional dithering pass. A row-major 2D framebuffer (see apa102_matrix.h) is dimmed in fixed point, the fraction that would be lost by the 8-bit PWM is spread over neighbouring pixels. The ordered mode adds a precomputed 8x8 Bayer threshold matrix and needs no RAM, the Floyd-Steinberg mode diffuses the error into the following pixels and rows.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_DITHER_H_
+#define APA102_DITHER_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_DITHER_WIDTH
+        /**
+         * @def APA102_DITHER_WIDTH
+         * @brief Defines the maximum framebuffer width of the Floyd-Steinberg mode.
+         *
+         * @details
+         * The Floyd-Steinberg mode keeps the error of two rows in RAM. Set this macro to `0` if only the ordered mode is used, the Floyd-Steinberg mode is then not compiled.
+         */
+        #define APA102_DITHER_WIDTH 64
+    #endif
+
+    /**
+     * @def APA102_DITHER_RAM
+     * @brief Static RAM in bytes used by the dithering pass (error rows of the Floyd-Steinberg mode).
+     */
+    #define APA102_DITHER_RAM ((APA102_DITHER_WIDTH) ? (2 * 3 * ((APA102_DITHER_WIDTH) + 2) * sizeof(signed int)) : 0)
+
+    /**
+     * @enum APA102_Dither_Mode_t
+     * @brief Enumerates the dithering modes.
+     */
+    enum APA102_Dither_Mode_t
+    {
+        APA102_Dither_None=0,           /**< Dimming without dithering (fraction truncated). */
+        APA102_Dither_Ordered,          /**< Ordered dithering with a 8x8 Bayer threshold matrix. */
+        APA102_Dither_FloydSteinberg    /**< Error diffusion, framebuffer width up to `APA102_DITHER_WIDTH`. */
+    };
+    /**
+     * @typedef APA102_Dither_Mode
+     * @brief Alias for enum APA102_Dither_Mode_t representing the dithering mode.
+     */
+    typedef enum APA102_Dither_Mode_t APA102_Dither_Mode;
+
+    void apa102_dither(GFX_RGBA_Color *pixels, unsigned int width, unsigned int height, unsigned char scale, APA102_Dither_Mode mode);
+
+#endif /* APA102_DITHER_H_ */
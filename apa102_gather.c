@@ -0,0 +1,262 @@
+/**
+ * @file apa102_gather.c
+ * @brief Implementation of the scatter-gather transmission of LED data sequences.
+ *
+ * This source file implements the transmission of a segment list as one LED data sequence. On Linux with a `spidev` device the segments are passed as `spi_ioc_transfer` arrays, otherwise every segment is handed to the SPI hardware abstraction layer with `APA102_GATHER_TRANSFER`.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_gather.h"
+
+#ifdef APA102_GATHER_AVAILABLE
+
+    #ifdef APA102_RECORDER_AVAILABLE
+        #include "apa102_recorder.h"
+    #endif
+
+    // Pedantic-clean fill of the constant blocks: the binary digits of the size select blocks of 2^n values
+    #define APA102_GATHER_REPEAT_1(value) value,
+    #define APA102_GATHER_REPEAT_2(value) APA102_GATHER_REPEAT_1(value) APA102_GATHER_REPEAT_1(value)
+    #define APA102_GATHER_REPEAT_4(value) APA102_GATHER_REPEAT_2(value) APA102_GATHER_REPEAT_2(value)
+    #define APA102_GATHER_REPEAT_8(value) APA102_GATHER_REPEAT_4(value) APA102_GATHER_REPEAT_4(value)
+    #define APA102_GATHER_REPEAT_16(value) APA102_GATHER_REPEAT_8(value) APA102_GATHER_REPEAT_8(value)
+    #define APA102_GATHER_REPEAT_32(value) APA102_GATHER_REPEAT_16(value) APA102_GATHER_REPEAT_16(value)
+    #define APA102_GATHER_REPEAT_64(value) APA102_GATHER_REPEAT_32(value) APA102_GATHER_REPEAT_32(value)
+    #define APA102_GATHER_REPEAT_128(value) APA102_GATHER_REPEAT_64(value) APA102_GATHER_REPEAT_64(value)
+    #define APA102_GATHER_REPEAT_256(value) APA102_GATHER_REPEAT_128(value) APA102_GATHER_REPEAT_128(value)
+    #define APA102_GATHER_REPEAT_512(value) APA102_GATHER_REPEAT_256(value) APA102_GATHER_REPEAT_256(value)
+    #define APA102_GATHER_REPEAT_1024(value) APA102_GATHER_REPEAT_512(value) APA102_GATHER_REPEAT_512(value)
+    #define APA102_GATHER_REPEAT_2048(value) APA102_GATHER_REPEAT_1024(value) APA102_GATHER_REPEAT_1024(value)
+    #define APA102_GATHER_REPEAT_4096(value) APA102_GATHER_REPEAT_2048(value) APA102_GATHER_REPEAT_2048(value)
+    #define APA102_GATHER_REPEAT_8192(value) APA102_GATHER_REPEAT_4096(value) APA102_GATHER_REPEAT_4096(value)
+    #define APA102_GATHER_REPEAT_16384(value) APA102_GATHER_REPEAT_8192(value) APA102_GATHER_REPEAT_8192(value)
+
+    #if ((APA102_FRAME_SIZE) < 1) || ((APA102_FRAME_SIZE) > 0x7F) || ((APA102_EOF_SIZE) < 1) || ((APA102_EOF_SIZE) > 0x7FFF)
+        #error "APA102_GATHER_AVAILABLE supports start frames of 1 up to 127 bytes and end frames of 1 up to 32767 bytes"
+    #endif
+
+    static const unsigned char apa102_gather_sof[APA102_FRAME_SIZE] = {
+        #if ((APA102_FRAME_SIZE) >> 0) & 1
+            APA102_GATHER_REPEAT_1(APA102_SOF_VALUE)
+        #endif
+        #if ((APA102_FRAME_SIZE) >> 1) & 1
+            APA102_GATHER_REPEAT_2(APA102_SOF_VALUE)
+        #endif
+        #if ((APA102_FRAME_SIZE) >> 2) & 1
+            APA102_GATHER_REPEAT_4(APA102_SOF_VALUE)
+        #endif
+        #if ((APA102_FRAME_SIZE) >> 3) & 1
+            APA102_GATHER_REPEAT_8(APA102_SOF_VALUE)
+        #endif
+        #if ((APA102_FRAME_SIZE) >> 4) & 1
+            APA102_GATHER_REPEAT_16(APA102_SOF_VALUE)
+        #endif
+        #if ((APA102_FRAME_SIZE) >> 5) & 1
+            APA102_GATHER_REPEAT_32(APA102_SOF_VALUE)
+        #endif
+        #if ((APA102_FRAME_SIZE) >> 6) & 1
+            APA102_GATHER_REPEAT_64(APA102_SOF_VALUE)
+        #endif
+    };
+
+    static const unsigned char apa102_gather_eof[APA102_EOF_SIZE] = {
+        #if ((APA102_EOF_SIZE) >> 0) & 1
+            APA102_GATHER_REPEAT_1(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 1) & 1
+            APA102_GATHER_REPEAT_2(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 2) & 1
+            APA102_GATHER_REPEAT_4(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 3) & 1
+            APA102_GATHER_REPEAT_8(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 4) & 1
+            APA102_GATHER_REPEAT_16(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 5) & 1
+            APA102_GATHER_REPEAT_32(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 6) & 1
+            APA102_GATHER_REPEAT_64(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 7) & 1
+            APA102_GATHER_REPEAT_128(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 8) & 1
+            APA102_GATHER_REPEAT_256(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 9) & 1
+            APA102_GATHER_REPEAT_512(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 10) & 1
+            APA102_GATHER_REPEAT_1024(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 11) & 1
+            APA102_GATHER_REPEAT_2048(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 12) & 1
+            APA102_GATHER_REPEAT_4096(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 13) & 1
+            APA102_GATHER_REPEAT_8192(APA102_EOF_VALUE)
+        #endif
+        #if ((APA102_EOF_SIZE) >> 14) & 1
+            APA102_GATHER_REPEAT_16384(APA102_EOF_VALUE)
+        #endif
+    };
+
+    static APA102_Gather_Segment apa102_gather_segment(const APA102_Gather_Segment *segment)
+    {
+        if (segment->data)
+        {
+            return *segment;
+        }
+        else if (segment->length == APA102_Gather_Start)
+        {
+            return (APA102_Gather_Segment){ apa102_gather_sof, APA102_FRAME_SIZE };
+        }
+        else if (segment->length == APA102_Gather_End)
+        {
+            return (APA102_Gather_Segment){ apa102_gather_eof, APA102_EOF_SIZE };
+        }
+        return (APA102_Gather_Segment){ 0, 0 };
+    }
+
+    #ifdef __linux__
+
+        #include <string.h>
+        #include <sys/ioctl.h>
+        #include <linux/spi/spidev.h>
+
+        static int apa102_gather_fd = -1;
+
+        /**
+         * @brief Select the `spidev` device used for the scatter-gather transmission.
+         *
+         * @param fd File descriptor of an opened and configured `spidev` device, `-1` to send via `APA102_GATHER_TRANSFER`.
+         */
+        void apa102_gather_device(int fd)
+        {
+            apa102_gather_fd = fd;
+        }
+
+        static APA102_Gather_Status apa102_gather_message(struct spi_ioc_transfer *transfers, unsigned int used)
+        {
+            APA102_Gather_Status status = APA102_Gather_Ok;
+
+            if (used && (ioctl(apa102_gather_fd, SPI_IOC_MESSAGE(used), transfers) < 0))
+            {
+                status = APA102_Gather_Error;
+            }
+            memset(transfers, 0, APA102_GATHER_TRANSFERS * sizeof(struct spi_ioc_transfer));
+
+            return status;
+        }
+
+        static APA102_Gather_Status apa102_gather_spidev(const APA102_Gather_Segment *segments, unsigned int count)
+        {
+            struct spi_ioc_transfer transfers[APA102_GATHER_TRANSFERS];
+            unsigned int used = 0;
+
+            memset(transfers, 0, sizeof(transfers));
+
+            for (unsigned int i=0; i < count; i++)
+            {
+                APA102_Gather_Segment segment = apa102_gather_segment(&segments[i]);
+                const unsigned char *data = segment.data;
+                unsigned int length = segment.length;
+
+                while (length)
+                {
+                    unsigned int chunk = (length > APA102_GATHER_CHUNK) ? APA102_GATHER_CHUNK : length;
+
+                    transfers[used].tx_buf = (unsigned long)data;
+                    transfers[used].len = chunk;
+                    used++;
+
+                    data += chunk;
+                    length -= chunk;
+
+                    if (used == APA102_GATHER_TRANSFERS)
+                    {
+                        if (apa102_gather_message(transfers, used) != APA102_Gather_Ok)
+                        {
+                            return APA102_Gather_Error;
+                        }
+                        used = 0;
+                    }
+                }
+            }
+            return apa102_gather_message(transfers, used);
+        }
+    #endif
+
+    /**
+     * @brief Transmit a list of segments as one LED data sequence.
+     *
+     * @param segments Pointer to the segments in the order they are sent.
+     * @param count Number of segments.
+     *
+     * @return `APA102_Gather_Ok` if all segments were sent, `APA102_Gather_Error` if the `spidev` transfer failed.
+     *
+     * @details
+     * The segments are not copied. The list usually starts with `APA102_GATHER_SOF`, followed by slices of encoded LED frames (`APA102_GATHER_LEDS`) and ends with `APA102_GATHER_EOF`. The transmission is wrapped with `apa102_sequence_begin()` and `apa102_sequence_end()`, so a shared bus is locked and the recorder captures the sequence like a blocking refresh.
+     *
+     * @note The function blocks until all segments are transmitted.
+     */
+    APA102_Gather_Status apa102_gather(const APA102_Gather_Segment *segments, unsigned int count)
+    {
+        APA102_Gather_Status status = APA102_Gather_Ok;
+
+        apa102_sequence_begin();
+
+        #ifdef __linux__
+            if (apa102_gather_fd >= 0)
+            {
+                #ifdef APA102_RECORDER_AVAILABLE
+                    for (unsigned int i=0; i < count; i++)
+                    {
+                        APA102_Gather_Segment segment = apa102_gather_segment(&segments[i]);
+
+                        for (unsigned int j=0; j < segment.length; j++)
+                        {
+                            apa102_recorder_write(segment.data[j]);
+                        }
+                    }
+                #endif
+
+                status = apa102_gather_spidev(segments, count);
+                apa102_sequence_end();
+
+                return status;
+            }
+        #endif
+
+        for (unsigned int i=0; i < count; i++)
+        {
+            APA102_Gather_Segment segment = apa102_gather_segment(&segments[i]);
+
+            if (segment.length)
+            {
+                APA102_GATHER_TRANSFER(segment.data, segment.length);
+            }
+        }
+
+        apa102_sequence_end();
+
+        return status;
+    }
+
+#endif
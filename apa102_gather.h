@@ -0,0 +1,138 @@
+/**
+ * @file apa102_gather.h
+ * @brief Scatter-gather transmission of LED data sequences for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional scatter-gather transmission. A LED data sequence is described as a list of segments (constant start and end frame blocks, one or more slices of already encoded LED frames) that are handed to the SPI layer one after the other. The sequence never has to be assembled in a contiguous buffer. On Linux the segments can be passed to `spidev` as a single `SPI_IOC_MESSAGE` transfer array.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_GATHER_H_
+#define APA102_GATHER_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_GATHER_TRANSFER
+        /**
+         * @def APA102_GATHER_TRANSFER
+         * @brief Transmits a segment on platforms without `spidev`.
+         *
+         * @details
+         * The default sends the segment byte by byte with `apa102_write()`. Redefine this macro to hand the segment to a bulk or DMA function of the SPI hardware abstraction layer.
+         */
+        #define APA102_GATHER_TRANSFER(data, length) apa102_write((data), (length))
+    #endif
+
+    #ifndef APA102_GATHER_TRANSFERS
+        /**
+         * @def APA102_GATHER_TRANSFERS
+         * @brief Maximum number of transfers in a single `SPI_IOC_MESSAGE` call on Linux.
+         *
+         * @details
+         * Segments longer than `APA102_GATHER_CHUNK` bytes take multiple transfers. Longer lists are split into multiple calls.
+         */
+        #define APA102_GATHER_TRANSFERS 16
+    #endif
+
+    #ifndef APA102_GATHER_CHUNK
+        /**
+         * @def APA102_GATHER_CHUNK
+         * @brief Maximum number of bytes of a single transfer on Linux (default buffer size of `spidev`).
+         */
+        #define APA102_GATHER_CHUNK 4096U
+    #endif
+
+    /**
+     * @def APA102_GATHER_RAM
+     * @brief Static RAM in bytes used by the scatter-gather transmission (`spidev` file descriptor on Linux).
+     *
+     * @note The constant start and end frame blocks are not included. They are located in flash on targets that keep read-only data in flash (e.g. avrxmega3), otherwise they take `APA102_FRAME_SIZE + APA102_EOF_SIZE` bytes of read-only data.
+     */
+    #ifdef __linux__
+        #define APA102_GATHER_RAM (sizeof(int))
+    #else
+        #define APA102_GATHER_RAM 0
+    #endif
+
+    /**
+     * @enum APA102_Gather_Status_t
+     * @brief Enumerates the results of the scatter-gather transmission.
+     */
+    enum APA102_Gather_Status_t
+    {
+        APA102_Gather_Ok=0,
+        APA102_Gather_Error
+    };
+    /**
+     * @typedef APA102_Gather_Status
+     * @brief Alias for enum APA102_Gather_Status_t representing the result of the scatter-gather transmission.
+     */
+    typedef enum APA102_Gather_Status_t APA102_Gather_Status;
+
+    /**
+     * @enum APA102_Gather_Block_t
+     * @brief Enumerates the constant frame blocks of the driver that can be used as segment.
+     */
+    enum APA102_Gather_Block_t
+    {
+        APA102_Gather_Start=1,
+        APA102_Gather_End
+    };
+    /**
+     * @typedef APA102_Gather_Block
+     * @brief Alias for enum APA102_Gather_Block_t representing a constant frame block.
+     */
+    typedef enum APA102_Gather_Block_t APA102_Gather_Block;
+
+    /**
+     * @struct APA102_Gather_Segment_t
+     * @brief Segment of a LED data sequence.
+     *
+     * @details
+     * The `data` is sent unchanged, LED frames have to be encoded in advance with `apa102_encode()`. Segments are referenced, not copied, and have to stay valid until the transmission returns. A segment without `data` stands for the constant frame block selected by `length` (`APA102_Gather_Block`), see `APA102_GATHER_SOF` and `APA102_GATHER_EOF`.
+     */
+    struct APA102_Gather_Segment_t
+    {
+        const unsigned char *data;
+        unsigned int length;
+    };
+    /**
+     * @typedef APA102_Gather_Segment
+     * @brief Alias for struct APA102_Gather_Segment_t representing a segment of a LED data sequence.
+     */
+    typedef struct APA102_Gather_Segment_t APA102_Gather_Segment;
+
+    /**
+     * @def APA102_GATHER_SOF
+     * @brief Segment of the constant start frame (`APA102_FRAME_SIZE` bytes).
+     */
+    #define APA102_GATHER_SOF ((APA102_Gather_Segment){ 0, APA102_Gather_Start })
+
+    /**
+     * @def APA102_GATHER_EOF
+     * @brief Segment of the constant end frame (`APA102_EOF_SIZE` bytes).
+     */
+    #define APA102_GATHER_EOF ((APA102_Gather_Segment){ 0, APA102_Gather_End })
+
+    /**
+     * @def APA102_GATHER_LEDS
+     * @brief Segment of `leds` encoded LED frames starting at LED `first` of the buffer `frames`.
+     */
+    #define APA102_GATHER_LEDS(frames, first, leds) ((APA102_Gather_Segment){ (frames) + ((unsigned int)(first) * APA102_LED_FRAME_SIZE), (unsigned int)(leds) * APA102_LED_FRAME_SIZE })
+
+    #ifdef __linux__
+        void apa102_gather_device(int fd);
+    #endif
+
+    APA102_Gather_Status apa102_gather(const APA102_Gather_Segment *segments, unsigned int count);
+
+#endif /* APA102_GATHER_H_ */
@@ -0,0 +1,143 @@
+/**
+ * @file apa102_matrix.c
+ * @brief Implementation of the 2D mapping of LED matrices.
+ *
+ * This source file implements the conversion between framebuffer coordinates and strip positions and the transmission of a row-major framebuffer in strip order.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_matrix.h"
+
+#ifdef APA102_MATRIX_AVAILABLE
+
+    /**
+     * @brief Calculate the position on the strip of a matrix pixel.
+     *
+     * @param matrix Pointer to the size and wiring of the matrix.
+     * @param x Column of the pixel (`0` is the left side).
+     * @param y Row of the pixel (`0` is the top).
+     *
+     * @return Position of the LED on the strip.
+     */
+    unsigned int apa102_matrix_index(const APA102_Matrix *matrix, unsigned int x, unsigned int y)
+    {
+        unsigned int major, minor, length;
+
+        if (matrix->layout & APA102_Matrix_FlipX)
+        {
+            x = matrix->width - 1 - x;
+        }
+        if (matrix->layout & APA102_Matrix_FlipY)
+        {
+            y = matrix->height - 1 - y;
+        }
+
+        if (matrix->layout & APA102_Matrix_Columns)
+        {
+            major = x;
+            minor = y;
+            length = matrix->height;
+        }
+        else
+        {
+            major = y;
+            minor = x;
+            length = matrix->width;
+        }
+
+        if ((matrix->layout & APA102_Matrix_Serpentine) && (major & 0x01))
+        {
+            minor = length - 1 - minor;
+        }
+        return (major * length) + minor;
+    }
+
+    /**
+     * @brief Calculate the matrix pixel of a position on the strip.
+     *
+     * @param matrix Pointer to the size and wiring of the matrix.
+     * @param index Position of the LED on the strip.
+     * @param x Pointer where the column of the pixel is stored.
+     * @param y Pointer where the row of the pixel is stored.
+     */
+    void apa102_matrix_position(const APA102_Matrix *matrix, unsigned int index, unsigned int *x, unsigned int *y)
+    {
+        unsigned int length = (matrix->layout & APA102_Matrix_Columns) ? matrix->height : matrix->width;
+        unsigned int major = index / length;
+        unsigned int minor = index % length;
+
+        if ((matrix->layout & APA102_Matrix_Serpentine) && (major & 0x01))
+        {
+            minor = length - 1 - minor;
+        }
+
+        if (matrix->layout & APA102_Matrix_Columns)
+        {
+            *x = major;
+            *y = minor;
+        }
+        else
+        {
+            *x = minor;
+            *y = major;
+        }
+
+        if (matrix->layout & APA102_Matrix_FlipX)
+        {
+            *x = matrix->width - 1 - *x;
+        }
+        if (matrix->layout & APA102_Matrix_FlipY)
+        {
+            *y = matrix->height - 1 - *y;
+        }
+    }
+
+    /**
+     * @brief Transmit a row-major framebuffer to the LED matrix.
+     *
+     * @param matrix Pointer to the size and wiring of the matrix.
+     * @param pixels Pointer to the framebuffer with `width * height` colors, row by row from the top left pixel.
+     *
+     * @details
+     * The function sends a complete LED data sequence. The pixels are read in the order of the strip, so every LED frame is sent with `apa102_led()` right after its pixel was looked up. Rows (columns) are walked with a step instead of mapping every LED separately.
+     */
+    void apa102_matrix_show(const APA102_Matrix *matrix, const GFX_RGBA_Color *pixels)
+    {
+        unsigned char columns = (matrix->layout & APA102_Matrix_Columns) ? 1 : 0;
+        unsigned char flip = (matrix->layout & (columns ? APA102_Matrix_FlipY : APA102_Matrix_FlipX)) ? 1 : 0;
+        unsigned int lines = columns ? matrix->width : matrix->height;
+        unsigned int length = columns ? matrix->height : matrix->width;
+        unsigned int step = columns ? matrix->width : 1;
+
+        APA102_SOF();
+
+        for (unsigned int major=0; major < lines; major++)
+        {
+            unsigned int x, y;
+            unsigned char backwards = flip ^ (((matrix->layout & APA102_Matrix_Serpentine) && (major & 0x01)) ? 1 : 0);
+
+            apa102_matrix_position(matrix, major * length, &x, &y);
+
+            unsigned int index = (y * matrix->width) + x;
+
+            for (unsigned int minor=0; minor < length; minor++)
+            {
+                apa102_led(&pixels[index]);
+                index = backwards ? (index - step) : (index + step);
+            }
+        }
+
+        APA102_EOF();
+    }
+
+#endif
@@ -0,0 +1,65 @@
+/**
+ * @file apa102_matrix.h
+ * @brief 2D mapping of LED matrices for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional 2D mapping. Effects render into a row-major framebuffer addressed with `x`/`y` coordinates, the layout describes how the strip is wired through the matrix (rows or columns, progressive or serpentine, flipped axes). The mapping is resolved while the LED frames are sent, so the framebuffer never has to be reordered.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_MATRIX_H_
+#define APA102_MATRIX_H_
+
+    #include "apa102.h"
+
+    /**
+     * @enum APA102_Matrix_Layout_t
+     * @brief Enumerates the wiring options of a LED matrix, the values can be combined.
+     *
+     * @details
+     * Without options the strip starts at the top left pixel and runs through every row from left to right.
+     */
+    enum APA102_Matrix_Layout_t
+    {
+        APA102_Matrix_Progressive=0x00, /**< Every row (column) starts on the same side. */
+        APA102_Matrix_Serpentine=0x01,  /**< Every second row (column) runs in the opposite direction. */
+        APA102_Matrix_Columns=0x02,     /**< The strip runs through columns instead of rows. */
+        APA102_Matrix_FlipX=0x04,       /**< The strip starts on the right side. */
+        APA102_Matrix_FlipY=0x08        /**< The strip starts at the bottom. */
+    };
+    /**
+     * @typedef APA102_Matrix_Layout
+     * @brief Alias for enum APA102_Matrix_Layout_t representing the wiring options of a LED matrix.
+     */
+    typedef enum APA102_Matrix_Layout_t APA102_Matrix_Layout;
+
+    /**
+     * @struct APA102_Matrix_t
+     * @brief Size and wiring of a LED matrix.
+     */
+    struct APA102_Matrix_t
+    {
+        unsigned int width;
+        unsigned int height;
+        unsigned char layout;
+    };
+    /**
+     * @typedef APA102_Matrix
+     * @brief Alias for struct APA102_Matrix_t representing the size and wiring of a LED matrix.
+     */
+    typedef struct APA102_Matrix_t APA102_Matrix;
+
+    unsigned int apa102_matrix_index(const APA102_Matrix *matrix, unsigned int x, unsigned int y);
+    void apa102_matrix_position(const APA102_Matrix *matrix, unsigned int index, unsigned int *x, unsigned int *y);
+    void apa102_matrix_show(const APA102_Matrix *matrix, const GFX_RGBA_Color *pixels);
+
+#endif /* APA102_MATRIX_H_ */
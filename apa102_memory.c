@@ -0,0 +1,37 @@
+/**
+ * @file apa102_memory.c
+ * @brief Compile-time checks and report of the static memory plan.
+ *
+ * This source file checks the static RAM of the enabled features against `APA102_RAM_BUDGET`. When compiled with `APA102_RAM_REPORT` (done by `tools/memory/apa102_memory.sh`), it emits one symbol per feature whose size is the RAM of the feature plus one byte, so the report is evaluated by the target compiler with the project configuration.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_memory.h"
+
+#if defined(APA102_RAM_BUDGET) && !defined(_DOXYGEN_)
+    _Static_assert(APA102_RAM_TOTAL <= APA102_RAM_BUDGET, "APA102 driver exceeds APA102_RAM_BUDGET, see tools/memory/apa102_memory.sh for a report");
+#endif
+
+#ifdef APA102_RAM_REPORT
+    const unsigned char apa102_ram_correction[APA102_RAM_CORRECTION + 1];
+    const unsigned char apa102_ram_calibration[APA102_RAM_CALIBRATION + 1];
+    const unsigned char apa102_ram_recorder[APA102_RAM_RECORDER + 1];
+    const unsigned char apa102_ram_bus[APA102_RAM_BUS + 1];
+    const unsigned char apa102_ram_tx[APA102_RAM_TX + 1];
+    const unsigned char apa102_ram_gather[APA102_RAM_GATHER + 1];
+    const unsigned char apa102_ram_dither[APA102_RAM_DITHER + 1];
+    const unsigned char apa102_ram_pipeline[APA102_RAM_PIPELINE + 1];
+    const unsigned char apa102_ram_particle[APA102_RAM_PARTICLE + 1];
+    const unsigned char apa102_ram_serial[APA102_RAM_SERIAL + 1];
+    const unsigned char apa102_ram_total[APA102_RAM_TOTAL + 1];
+#endif
@@ -0,0 +1,165 @@
+/**
+ * @file apa102_memory.h
+ * @brief Static memory plan of the APA102 LED driver.
+ *
+ * This header file sums up the static RAM of every enabled feature of the driver. All buffers are sized at compile time from the configuration macros (e.g. `APA102_NUMBER_OF_LEDS`) and placed in static storage, the driver does not use the heap. If `APA102_RAM_BUDGET` is defined, the build fails when the enabled features exceed the budget. A report of the bytes per feature can be generated at build time with `tools/memory/apa102_memory.sh`.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_MEMORY_H_
+#define APA102_MEMORY_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_RAM_BUDGET
+        /**
+         * @def APA102_RAM_BUDGET
+         * @brief Defines the maximum static RAM in bytes the driver may use.
+         *
+         * @details
+         * Define this macro (e.g. with a part of the 2048 bytes of an ATtiny1616) to let the build fail if the enabled features of the driver need more static RAM. Without this macro no check is done.
+         */
+        //#define APA102_RAM_BUDGET 512
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_RAM_BUDGET
+        #endif
+    #endif
+
+    #ifdef APA102_CORRECTION_AVAILABLE
+        #include "apa102_correction.h"
+
+        /**
+         * @def APA102_RAM_CORRECTION
+         * @brief Static RAM in bytes of the colour-correction stage, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_CORRECTION APA102_CORRECTION_RAM
+    #else
+        #define APA102_RAM_CORRECTION 0
+    #endif
+
+    #ifdef APA102_CALIBRATION_AVAILABLE
+        #include "apa102_calibration.h"
+
+        /**
+         * @def APA102_RAM_CALIBRATION
+         * @brief Static RAM in bytes of the per-LED calibration, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_CALIBRATION APA102_CALIBRATION_RAM
+    #else
+        #define APA102_RAM_CALIBRATION 0
+    #endif
+
+    #ifdef APA102_RECORDER_AVAILABLE
+        #include "apa102_recorder.h"
+
+        /**
+         * @def APA102_RAM_RECORDER
+         * @brief Static RAM in bytes of the frame recorder, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_RECORDER APA102_RECORDER_RAM
+    #else
+        #define APA102_RAM_RECORDER 0
+    #endif
+
+    #ifdef APA102_BUS_AVAILABLE
+        #include "apa102_bus.h"
+
+        /**
+         * @def APA102_RAM_BUS
+         * @brief Static RAM in bytes of the bus sharing support, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_BUS APA102_BUS_RAM
+    #else
+        #define APA102_RAM_BUS 0
+    #endif
+
+    #ifdef APA102_TX_AVAILABLE
+        #include "apa102_tx.h"
+
+        /**
+         * @def APA102_RAM_TX
+         * @brief Static RAM in bytes of the cooperative transmission, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_TX APA102_TX_RAM
+    #else
+        #define APA102_RAM_TX 0
+    #endif
+
+    #ifdef APA102_GATHER_AVAILABLE
+        #include "apa102_gather.h"
+
+        /**
+         * @def APA102_RAM_GATHER
+         * @brief Static RAM in bytes of the scatter-gather transmission, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_GATHER APA102_GATHER_RAM
+    #else
+        #define APA102_RAM_GATHER 0
+    #endif
+
+    #ifdef APA102_DITHER_AVAILABLE
+        #include "apa102_dither.h"
+
+        /**
+         * @def APA102_RAM_DITHER
+         * @brief Static RAM in bytes of the dithering pass, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_DITHER APA102_DITHER_RAM
+    #else
+        #define APA102_RAM_DITHER 0
+    #endif
+
+    #ifdef APA102_PIPELINE_AVAILABLE
+        #include "apa102_pipeline.h"
+
+        /**
+         * @def APA102_RAM_PIPELINE
+         * @brief Static RAM in bytes of the fused pixel pipeline, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_PIPELINE APA102_PIPELINE_RAM
+    #else
+        #define APA102_RAM_PIPELINE 0
+    #endif
+
+    #ifdef APA102_PARTICLE_AVAILABLE
+        #include "apa102_particle.h"
+
+        /**
+         * @def APA102_RAM_PARTICLE
+         * @brief Static RAM in bytes of the particle engine, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_PARTICLE APA102_PARTICLE_RAM
+    #else
+        #define APA102_RAM_PARTICLE 0
+    #endif
+
+    #ifdef APA102_SERIAL_AVAILABLE
+        #include "apa102_serial.h"
+
+        /**
+         * @def APA102_RAM_SERIAL
+         * @brief Static RAM in bytes of the serial receiver, `0` if the feature is disabled.
+         */
+        #define APA102_RAM_SERIAL APA102_SERIAL_RAM
+    #else
+        #define APA102_RAM_SERIAL 0
+    #endif
+
+    /**
+     * @def APA102_RAM_TOTAL
+     * @brief Static RAM in bytes of all enabled features of the driver.
+     */
+    #define APA102_RAM_TOTAL (APA102_RAM_CORRECTION + APA102_RAM_CALIBRATION + APA102_RAM_RECORDER + APA102_RAM_BUS + APA102_RAM_TX + APA102_RAM_GATHER + APA102_RAM_DITHER + APA102_RAM_PIPELINE + APA102_RAM_PARTICLE + APA102_RAM_SERIAL)
+
+#endif /* APA102_MEMORY_H_ */
@@ -0,0 +1,399 @@
+/**
+ * @file apa102_noise.c
+ * @brief Implementation of the fixed-point simplex noise.
+ *
+ * This source file implements simplex noise with integer arithmetic. Coordinates are skewed with 16-bit factors (split multiplication without 32-bit overflow), the offsets inside a simplex are unskewed from the fraction of the skewed coordinates in 1/4096 cell (independent of the cell index) and the falloff `t^4` of every corner is kept in 16 bits (1/65536). The line functions advance the skew of neighbouring LEDs by additions and only look up the gradients when a LED enters a new cell.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_noise.h"
+
+#ifdef APA102_NOISE_AVAILABLE
+
+    #define APA102_NOISE_ONE 4096L          /* one cell in 1/4096 */
+    #define APA102_NOISE_F2 23987UL         /* (sqrt(3) - 1) / 2 in 1/65536 */
+    #define APA102_NOISE_G2 13849UL         /* (3 - sqrt(3)) / 6 in 1/65536 */
+    #define APA102_NOISE_F3 21845UL         /* 1 / 3 in 1/65536 */
+    #define APA102_NOISE_G3 10923UL         /* 1 / 6 in 1/65536 */
+    #define APA102_NOISE_G2_CELL 866L       /* G2 in 1/4096 */
+    #define APA102_NOISE_G3_CELL 683L       /* G3 in 1/4096 */
+    #define APA102_NOISE_RADIUS2 8388608L   /* 0.5 in 1/16777216 */
+    #define APA102_NOISE_RADIUS3 10066330L  /* 0.6 in 1/16777216 */
+
+    #define APA102_NOISE_HASH(value) APA102_NOISE_READ(&apa102_noise_permutation[(unsigned char)(value)])
+
+    /**
+     * @brief Permutation table of the lattice hash (Ken Perlin's reference permutation).
+     */
+    const unsigned char apa102_noise_permutation[256] =
+    {
+        151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+        140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+        247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+         57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+         74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+         60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+         65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+        200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+         52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+        207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+        119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+        129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+        218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+         81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+        184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+        222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180
+    };
+
+    /**
+     * @brief Gradients of the lattice corners (edges of a cube, padded to 16 entries). Two-dimensional noise uses the first two components.
+     */
+    const signed char apa102_noise_gradients[16][3] =
+    {
+        {  1,  1,  0 }, { -1,  1,  0 }, {  1, -1,  0 }, { -1, -1,  0 },
+        {  1,  0,  1 }, { -1,  0,  1 }, {  1,  0, -1 }, { -1,  0, -1 },
+        {  0,  1,  1 }, {  0, -1,  1 }, {  0,  1, -1 }, {  0, -1, -1 },
+        {  1,  1,  0 }, {  0, -1,  1 }, { -1,  1,  0 }, {  0, -1, -1 }
+    };
+
+    /* value * factor / 65536 (rounded down) without overflow of 32 bits */
+    static unsigned long apa102_noise_skew(unsigned long value, unsigned long factor)
+    {
+        return ((value >> 16) * factor) + (((value & 0xFFFF) * factor) >> 16);
+    }
+
+    /* remainder of apa102_noise_skew() in 1/65536 */
+    static unsigned long apa102_noise_remainder(unsigned long value, unsigned long factor)
+    {
+        return ((value & 0xFFFF) * factor) & 0xFFFF;
+    }
+
+    /* fraction of a skewed coordinate inside its cell in 1/4096 cell (including the remainder of the skew) */
+    static signed long apa102_noise_fraction(unsigned long coordinate, unsigned long skew, unsigned long remainder)
+    {
+        return (signed long)((((coordinate + skew) & 0xFF) << 4) | (remainder >> 12));
+    }
+
+    static signed int apa102_noise_clamp(signed long value)
+    {
+        if (value > (APA102_NOISE_ONE - 1))
+        {
+            return (signed int)(APA102_NOISE_ONE - 1);
+        }
+        else if (value < -APA102_NOISE_ONE)
+        {
+            return (signed int)-APA102_NOISE_ONE;
+        }
+        return (signed int)value;
+    }
+
+    static void apa102_noise_hash2(unsigned long i, unsigned long j, unsigned char *corners)
+    {
+        const unsigned char j0 = APA102_NOISE_HASH(j);
+        const unsigned char j1 = APA102_NOISE_HASH(j + 1);
+
+        corners[0] = APA102_NOISE_HASH(i + j0) & 0x0F;
+        corners[1] = APA102_NOISE_HASH(i + 1 + j0) & 0x0F;
+        corners[2] = APA102_NOISE_HASH(i + j1) & 0x0F;
+        corners[3] = APA102_NOISE_HASH(i + 1 + j1) & 0x0F;
+    }
+
+    static void apa102_noise_hash3(unsigned long i, unsigned long j, unsigned long k, unsigned char *corners)
+    {
+        const unsigned char k0 = APA102_NOISE_HASH(k);
+        const unsigned char k1 = APA102_NOISE_HASH(k + 1);
+        const unsigned char jk[4] = { APA102_NOISE_HASH(j + k0), APA102_NOISE_HASH(j + 1 + k0), APA102_NOISE_HASH(j + k1), APA102_NOISE_HASH(j + 1 + k1) };
+
+        /* corner index: bit 0 x, bit 1 y, bit 2 z */
+        for (unsigned char corner=0; corner < 8; corner++)
+        {
+            corners[corner] = APA102_NOISE_HASH(i + (corner & 1) + jk[corner >> 1]) & 0x0F;
+        }
+    }
+
+    /* falloff (radius^2 - d^2) >> 9 in 1/32768 and gradient dot product in 1/4096 of a corner */
+    static void apa102_noise_corner(signed long radius, unsigned char gradient, signed long x, signed long y, signed long z, signed short *t, signed short *dot)
+    {
+        const signed char *vector = apa102_noise_gradients[gradient];
+        const signed long falloff = radius - (x * x) - (y * y) - (z * z);
+
+        *t = (falloff > 0) ? (signed short)(falloff >> 9) : 0;
+        *dot = (signed short)(((signed char)APA102_NOISE_READ(&vector[0]) * x) + ((signed char)APA102_NOISE_READ(&vector[1]) * y) + ((signed char)APA102_NOISE_READ(&vector[2]) * z));
+    }
+
+    static void apa102_noise_setup2(const unsigned char *corners, signed long x, signed long y, signed short *t, signed short *dot)
+    {
+        const unsigned char middle = (x > y) ? 1 : 2;
+
+        apa102_noise_corner(APA102_NOISE_RADIUS2, corners[0], x, y, 0, &t[0], &dot[0]);
+        apa102_noise_corner(APA102_NOISE_RADIUS2, corners[middle], x - ((middle & 1) ? APA102_NOISE_ONE : 0) + APA102_NOISE_G2_CELL, y - ((middle & 2) ? APA102_NOISE_ONE : 0) + APA102_NOISE_G2_CELL, 0, &t[1], &dot[1]);
+        apa102_noise_corner(APA102_NOISE_RADIUS2, corners[3], x - APA102_NOISE_ONE + (2 * APA102_NOISE_G2_CELL), y - APA102_NOISE_ONE + (2 * APA102_NOISE_G2_CELL), 0, &t[2], &dot[2]);
+    }
+
+    static void apa102_noise_setup3(const unsigned char *corners, signed long x, signed long y, signed long z, signed short *t, signed short *dot)
+    {
+        unsigned char first;
+        unsigned char second;
+
+        /* the order of the offsets selects the simplex inside the cell */
+        if (x >= y)
+        {
+            first = (y >= z) || (x >= z) ? 1 : 4;
+            second = (y >= z) ? 3 : 5;
+        }
+        else
+        {
+            first = (y < z) ? 4 : 2;
+            second = (y < z) || (x < z) ? 6 : 3;
+        }
+
+        apa102_noise_corner(APA102_NOISE_RADIUS3, corners[0], x, y, z, &t[0], &dot[0]);
+        apa102_noise_corner(APA102_NOISE_RADIUS3, corners[first], x - ((first & 1) ? APA102_NOISE_ONE : 0) + APA102_NOISE_G3_CELL, y - ((first & 2) ? APA102_NOISE_ONE : 0) + APA102_NOISE_G3_CELL, z - ((first & 4) ? APA102_NOISE_ONE : 0) + APA102_NOISE_G3_CELL, &t[1], &dot[1]);
+        apa102_noise_corner(APA102_NOISE_RADIUS3, corners[second], x - ((second & 1) ? APA102_NOISE_ONE : 0) + (2 * APA102_NOISE_G3_CELL), y - ((second & 2) ? APA102_NOISE_ONE : 0) + (2 * APA102_NOISE_G3_CELL), z - ((second & 4) ? APA102_NOISE_ONE : 0) + (2 * APA102_NOISE_G3_CELL), &t[2], &dot[2]);
+        apa102_noise_corner(APA102_NOISE_RADIUS3, corners[7], x - APA102_NOISE_ONE + (3 * APA102_NOISE_G3_CELL), y - APA102_NOISE_ONE + (3 * APA102_NOISE_G3_CELL), z - APA102_NOISE_ONE + (3 * APA102_NOISE_G3_CELL), &t[3], &dot[3]);
+    }
+
+    /* sum of t^4 * dot over the corners of one LED in 1/131072 (t^2 and t^4 in 1/65536), a corner adds less than 4096 */
+    static signed long apa102_noise_sum(const signed short *t, const signed short *dot, unsigned char corners)
+    {
+        signed long sum = 0;
+
+        for (unsigned char corner=0; corner < corners; corner++)
+        {
+            const signed long t2 = ((signed long)t[corner] * t[corner]) >> 14;
+            const signed long t4 = (t2 * t2) >> 16;
+
+            sum += (t4 * dot[corner]) >> 11;
+        }
+        return sum;
+    }
+
+    /* contribution of a corner of one-dimensional noise in 1/4096 */
+    static signed long apa102_noise_corner1(unsigned char hash, signed long x)
+    {
+        const signed long t1 = ((APA102_NOISE_ONE * APA102_NOISE_ONE) - (x * x)) >> 9;
+        const signed long t2 = (t1 * t1) >> 15;
+        const signed long t4 = (t2 * t2) >> 15;
+        const signed long gradient = 1 + (hash & 0x07);
+
+        return (t4 * ((hash & 0x08) ? -gradient : gradient) * x) >> 15;
+    }
+
+    static signed int apa102_noise_value1(unsigned char first, unsigned char second, signed long x)
+    {
+        return apa102_noise_clamp(((apa102_noise_corner1(first, x) + apa102_noise_corner1(second, x - APA102_NOISE_ONE)) * 101) >> 8);
+    }
+
+    /**
+     * @brief Calculate one-dimensional simplex noise.
+     *
+     * @param x Coordinate in 1/256 lattice cell (see `APA102_NOISE_COORDINATE`).
+     *
+     * @return Noise value from `-4096` up to `4095` (see `APA102_NOISE_BYTE`).
+     */
+    signed int apa102_noise1(unsigned long x)
+    {
+        const unsigned long i = x >> 8;
+
+        return apa102_noise_value1(APA102_NOISE_HASH(i), APA102_NOISE_HASH(i + 1), (signed long)(x & 0xFF) * 16);
+    }
+
+    /**
+     * @brief Calculate two-dimensional simplex noise.
+     *
+     * @param x Horizontal coordinate in 1/256 lattice cell (below `0x1000000`).
+     * @param y Vertical coordinate in 1/256 lattice cell (below `0x1000000`).
+     *
+     * @return Noise value from `-4096` up to `4095`.
+     */
+    signed int apa102_noise2(unsigned long x, unsigned long y)
+    {
+        const unsigned long skew = apa102_noise_skew(x + y, APA102_NOISE_F2);
+        const unsigned long remainder = apa102_noise_remainder(x + y, APA102_NOISE_F2);
+        const signed long fx = apa102_noise_fraction(x, skew, remainder);
+        const signed long fy = apa102_noise_fraction(y, skew, remainder);
+        const signed long unskew = ((fx + fy) * (signed long)APA102_NOISE_G2) >> 16;
+        unsigned char corners[4];
+        signed short t[3];
+        signed short dot[3];
+
+        apa102_noise_hash2((x + skew) >> 8, (y + skew) >> 8, corners);
+        apa102_noise_setup2(corners, fx - unskew, fy - unskew, t, dot);
+
+        return apa102_noise_clamp((apa102_noise_sum(t, dot, 3) * 70) >> 5);
+    }
+
+    /**
+     * @brief Calculate three-dimensional simplex noise.
+     *
+     * @param x Coordinate in 1/256 lattice cell (below `0x1000000`).
+     * @param y Coordinate in 1/256 lattice cell (below `0x1000000`).
+     * @param z Coordinate in 1/256 lattice cell (below `0x1000000`), usually the time of animated two-dimensional effects.
+     *
+     * @return Noise value from `-4096` up to `4095`.
+     */
+    signed int apa102_noise3(unsigned long x, unsigned long y, unsigned long z)
+    {
+        const unsigned long skew = apa102_noise_skew(x + y + z, APA102_NOISE_F3);
+        const unsigned long remainder = apa102_noise_remainder(x + y + z, APA102_NOISE_F3);
+        const signed long fx = apa102_noise_fraction(x, skew, remainder);
+        const signed long fy = apa102_noise_fraction(y, skew, remainder);
+        const signed long fz = apa102_noise_fraction(z, skew, remainder);
+        const signed long unskew = ((fx + fy + fz) * (signed long)APA102_NOISE_G3) >> 16;
+        unsigned char corners[8];
+        signed short t[4];
+        signed short dot[4];
+
+        apa102_noise_hash3((x + skew) >> 8, (y + skew) >> 8, (z + skew) >> 8, corners);
+        apa102_noise_setup3(corners, fx - unskew, fy - unskew, fz - unskew, t, dot);
+
+        return apa102_noise_clamp((apa102_noise_sum(t, dot, 4) * 32) >> 5);
+    }
+
+    /**
+     * @brief Calculate one-dimensional simplex noise of neighbouring LEDs.
+     *
+     * @param x Coordinate of the first LED in 1/256 lattice cell.
+     * @param step Distance between neighbouring LEDs in 1/256 lattice cell.
+     * @param values Pointer to the noise values of `count` LEDs.
+     * @param count Number of LEDs.
+     *
+     * @details
+     * The values are equal to `apa102_noise1(x + (n * step))`, the hashes are only looked up when a LED enters a new cell.
+     */
+    void apa102_noise_line1(unsigned long x, unsigned int step, signed int *values, unsigned int count)
+    {
+        unsigned long cell = x >> 8;
+        unsigned char first = APA102_NOISE_HASH(cell);
+        unsigned char second = APA102_NOISE_HASH(cell + 1);
+
+        for (unsigned int n=0; n < count; n++, x += step)
+        {
+            if ((x >> 8) != cell)
+            {
+                cell = x >> 8;
+                first = APA102_NOISE_HASH(cell);
+                second = APA102_NOISE_HASH(cell + 1);
+            }
+            values[n] = apa102_noise_value1(first, second, (signed long)(x & 0xFF) * 16);
+        }
+    }
+
+    /**
+     * @brief Calculate two-dimensional simplex noise of neighbouring LEDs along the horizontal axis.
+     *
+     * @param x Horizontal coordinate of the first LED in 1/256 lattice cell.
+     * @param y Vertical coordinate of all LEDs in 1/256 lattice cell.
+     * @param step Horizontal distance between neighbouring LEDs in 1/256 lattice cell.
+     * @param values Pointer to the noise values of `count` LEDs.
+     * @param count Number of LEDs.
+     *
+     * @details
+     * The values are equal to `apa102_noise2(x + (n * step), y)`. The skew is advanced by additions (with the exact remainder), the gradients of a cell are only looked up when a LED enters a new cell.
+     */
+    void apa102_noise_line2(unsigned long x, unsigned long y, unsigned int step, signed int *values, unsigned int count)
+    {
+        unsigned long skew = apa102_noise_skew(x + y, APA102_NOISE_F2);
+        unsigned long remainder = apa102_noise_remainder(x + y, APA102_NOISE_F2);
+        const unsigned long increment = apa102_noise_skew(step, APA102_NOISE_F2);
+        const unsigned long fraction = apa102_noise_remainder(step, APA102_NOISE_F2);
+        unsigned long ci = 0;
+        unsigned long cj = 0;
+        unsigned char valid = 0;
+        unsigned char corners[4];
+        signed short t[3];
+        signed short dot[3];
+
+        for (unsigned int n=0; n < count; n++)
+        {
+            const unsigned long i = (x + skew) >> 8;
+            const unsigned long j = (y + skew) >> 8;
+            const signed long fx = apa102_noise_fraction(x, skew, remainder);
+            const signed long fy = apa102_noise_fraction(y, skew, remainder);
+            const signed long unskew = ((fx + fy) * (signed long)APA102_NOISE_G2) >> 16;
+
+            if (!valid || (i != ci) || (j != cj))
+            {
+                ci = i;
+                cj = j;
+                valid = 1;
+                apa102_noise_hash2(i, j, corners);
+            }
+            apa102_noise_setup2(corners, fx - unskew, fy - unskew, t, dot);
+
+            values[n] = apa102_noise_clamp((apa102_noise_sum(t, dot, 3) * 70) >> 5);
+
+            x += step;
+            remainder += fraction;
+            skew += increment + (remainder >> 16);
+            remainder &= 0xFFFF;
+        }
+    }
+
+    /**
+     * @brief Calculate three-dimensional simplex noise of neighbouring LEDs along the first axis.
+     *
+     * @param x First coordinate of the first LED in 1/256 lattice cell.
+     * @param y Second coordinate of all LEDs in 1/256 lattice cell (e.g. the row of a matrix).
+     * @param z Third coordinate of all LEDs in 1/256 lattice cell (e.g. the time).
+     * @param step Distance between neighbouring LEDs in 1/256 lattice cell.
+     * @param values Pointer to the noise values of `count` LEDs.
+     * @param count Number of LEDs.
+     *
+     * @details
+     * The values are equal to `apa102_noise3(x + (n * step), y, z)`. The skew is advanced by additions (with the exact remainder), the gradients of a cell are only looked up when a LED enters a new cell.
+     */
+    void apa102_noise_line3(unsigned long x, unsigned long y, unsigned long z, unsigned int step, signed int *values, unsigned int count)
+    {
+        unsigned long skew = apa102_noise_skew(x + y + z, APA102_NOISE_F3);
+        unsigned long remainder = apa102_noise_remainder(x + y + z, APA102_NOISE_F3);
+        const unsigned long increment = apa102_noise_skew(step, APA102_NOISE_F3);
+        const unsigned long fraction = apa102_noise_remainder(step, APA102_NOISE_F3);
+        unsigned long ci = 0;
+        unsigned long cj = 0;
+        unsigned long ck = 0;
+        unsigned char valid = 0;
+        unsigned char corners[8];
+        signed short t[4];
+        signed short dot[4];
+
+        for (unsigned int n=0; n < count; n++)
+        {
+            const unsigned long i = (x + skew) >> 8;
+            const unsigned long j = (y + skew) >> 8;
+            const unsigned long k = (z + skew) >> 8;
+            const signed long fx = apa102_noise_fraction(x, skew, remainder);
+            const signed long fy = apa102_noise_fraction(y, skew, remainder);
+            const signed long fz = apa102_noise_fraction(z, skew, remainder);
+            const signed long unskew = ((fx + fy + fz) * (signed long)APA102_NOISE_G3) >> 16;
+
+            if (!valid || (i != ci) || (j != cj) || (k != ck))
+            {
+                ci = i;
+                cj = j;
+                ck = k;
+                valid = 1;
+                apa102_noise_hash3(i, j, k, corners);
+            }
+            apa102_noise_setup3(corners, fx - unskew, fy - unskew, fz - unskew, t, dot);
+
+            values[n] = apa102_noise_clamp((apa102_noise_sum(t, dot, 4) * 32) >> 5);
+
+            x += step;
+            remainder += fraction;
+            skew += increment + (remainder >> 16);
+            remainder &= 0xFFFF;
+        }
+    }
+
+#endif
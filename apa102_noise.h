@@ -0,0 +1,57 @@
+/**
+ * @file apa102_noise.h
+ * @brief Fixed-point simplex noise for organic effects of the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional noise generator. Simplex noise in one, two and three dimensions is calculated with integer arithmetic only (coordinates in 1/256 lattice cell, values in 1/4096) and constant permutation and gradient tables in flash. The line functions evaluate neighbouring LEDs incrementally: the skewed coordinates are advanced by additions and the gradients of a lattice cell are only looked up when a LED enters a new cell.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_NOISE_H_
+#define APA102_NOISE_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_NOISE_READ
+        /**
+         * @def APA102_NOISE_READ
+         * @brief Reads a byte of the permutation or gradient table.
+         *
+         * @details
+         * On platforms with memory mapped flash (e.g. avr0) the tables can be accessed directly. Redefine this macro (e.g. with `pgm_read_byte`) if the tables are located in a separate address space.
+         */
+        #define APA102_NOISE_READ(address) (*(address))
+    #endif
+
+    /**
+     * @def APA102_NOISE_COORDINATE
+     * @brief Converts a number of lattice cells into a fixed-point noise coordinate.
+     */
+    #define APA102_NOISE_COORDINATE(cells) ((unsigned long)(cells) << 8)
+
+    /**
+     * @def APA102_NOISE_BYTE
+     * @brief Converts a noise value (`-4096` up to `4095`) into a byte (`0` up to `255`), e.g. for a brightness or a hue.
+     */
+    #define APA102_NOISE_BYTE(value) ((unsigned char)(((value) + 4096) >> 5))
+
+    extern const unsigned char apa102_noise_permutation[256];
+    extern const signed char apa102_noise_gradients[16][3];
+
+    signed int apa102_noise1(unsigned long x);
+    signed int apa102_noise2(unsigned long x, unsigned long y);
+    signed int apa102_noise3(unsigned long x, unsigned long y, unsigned long z);
+    void apa102_noise_line1(unsigned long x, unsigned int step, signed int *values, unsigned int count);
+    void apa102_noise_line2(unsigned long x, unsigned long y, unsigned int step, signed int *values, unsigned int count);
+    void apa102_noise_line3(unsigned long x, unsigned long y, unsigned long z, unsigned int step, signed int *values, unsigned int count);
+
+#endif /* APA102_NOISE_H_ */
@@ -0,0 +1,333 @@
+/**
+ * @file apa102_palette.c
+ * @brief Implementation of the gradient palettes.
+ *
+ * This source file implements the interpolation of color stops and the ramps. Oklab is a linear transform of the cube roots of the LMS cone responses, so interpolating in Oklab equals interpolating the cube roots: the stops are linearised (table), transformed to LMS (matrix in 1/16384) and reduced with an integer cube root (1/32768, binary search of the cube), the interpolated values are cubed, transformed back to linear RGB (matrix in 1/4096) and converted to sRGB by a binary search in the linearisation table. No floating point is used.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_palette.h"
+
+#ifdef APA102_PALETTE_AVAILABLE
+
+    /* sRGB to linear light in 1/65535 */
+    static const unsigned int apa102_palette_linear[256] =
+    {
+            0,    20,    40,    60,    80,    99,   119,   139,
+          159,   179,   199,   219,   241,   264,   288,   313,
+          340,   367,   396,   427,   458,   491,   526,   562,
+          599,   637,   677,   718,   761,   805,   851,   898,
+          947,   997,  1048,  1101,  1156,  1212,  1270,  1330,
+         1391,  1453,  1517,  1583,  1651,  1720,  1790,  1863,
+         1937,  2013,  2090,  2170,  2250,  2333,  2418,  2504,
+         2592,  2681,  2773,  2866,  2961,  3058,  3157,  3258,
+         3360,  3464,  3570,  3678,  3788,  3900,  4014,  4129,
+         4247,  4366,  4488,  4611,  4736,  4864,  4993,  5124,
+         5257,  5392,  5530,  5669,  5810,  5953,  6099,  6246,
+         6395,  6547,  6700,  6856,  7014,  7174,  7335,  7500,
+         7666,  7834,  8004,  8177,  8352,  8528,  8708,  8889,
+         9072,  9258,  9445,  9635,  9828, 10022, 10219, 10417,
+        10619, 10822, 11028, 11235, 11446, 11658, 11873, 12090,
+        12309, 12530, 12754, 12980, 13209, 13440, 13673, 13909,
+        14146, 14387, 14629, 14874, 15122, 15371, 15623, 15878,
+        16135, 16394, 16656, 16920, 17187, 17456, 17727, 18001,
+        18277, 18556, 18837, 19121, 19407, 19696, 19987, 20281,
+        20577, 20876, 21177, 21481, 21787, 22096, 22407, 22721,
+        23038, 23357, 23678, 24002, 24329, 24658, 24990, 25325,
+        25662, 26001, 26344, 26688, 27036, 27386, 27739, 28094,
+        28452, 28813, 29176, 29542, 29911, 30282, 30656, 31033,
+        31412, 31794, 32179, 32567, 32957, 33350, 33745, 34143,
+        34544, 34948, 35355, 35764, 36176, 36591, 37008, 37429,
+        37852, 38278, 38706, 39138, 39572, 40009, 40449, 40891,
+        41337, 41785, 42236, 42690, 43147, 43606, 44069, 44534,
+        45002, 45473, 45947, 46423, 46903, 47385, 47871, 48359,
+        48850, 49344, 49841, 50341, 50844, 51349, 51858, 52369,
+        52884, 53401, 53921, 54445, 54971, 55500, 56032, 56567,
+        57105, 57646, 58190, 58737, 59287, 59840, 60396, 60955,
+        61517, 62082, 62650, 63221, 63795, 64372, 64952, 65535
+    };
+
+    /* linear RGB to LMS in 1/16384 */
+    static const signed int apa102_palette_lms[3][3] =
+    {
+        { 6754,  8787,   843 },
+        { 3472, 11152,  1760 },
+        { 1447,  4616, 10321 }
+    };
+
+    /* LMS to linear RGB in 1/4096 */
+    static const signed int apa102_palette_rgb[3][3] =
+    {
+        { 16698, -13548,   946 },
+        { -5196,  10690, -1398 },
+        {   -17,  -2881,  6994 }
+    };
+
+    /* stops of the segment that contains a position, channels in the interpolation space and intensity */
+    struct APA102_Palette_Segment_t
+    {
+        signed int start[4];
+        signed int end[4];
+        unsigned char from;
+        unsigned char span;
+        unsigned char last;
+    };
+    typedef struct APA102_Palette_Segment_t APA102_Palette_Segment;
+
+    /* cube of a value in 1/32768, result in 1/65536 */
+    static unsigned long apa102_palette_cube(unsigned long value)
+    {
+        return (((value * value) >> 14) * value) >> 15;
+    }
+
+    /* cube root of a value in 1/65536 by binary search of apa102_palette_cube(), result in 1/32768 */
+    static unsigned int apa102_palette_cbrt(unsigned long value)
+    {
+        unsigned int root = 0;
+
+        for (unsigned int bit=0x8000; bit; bit >>= 1)
+        {
+            if (apa102_palette_cube(root | bit) <= value)
+            {
+                root |= bit;
+            }
+        }
+        return root;
+    }
+
+    static unsigned char apa102_palette_gamma(unsigned long value)
+    {
+        unsigned char low = 0;
+
+        for (unsigned char step=0x80; step; step >>= 1)
+        {
+            if (APA102_PALETTE_READ(&apa102_palette_linear[low + step]) <= value)
+            {
+                low += step;
+            }
+        }
+
+        if ((low < 0xFF) && ((value - APA102_PALETTE_READ(&apa102_palette_linear[low])) > (APA102_PALETTE_READ(&apa102_palette_linear[low + 1]) - value)))
+        {
+            low++;
+        }
+        return low;
+    }
+
+    static void apa102_palette_convert(const GFX_RGBA_Color *color, APA102_Palette_Space space, signed int *channels)
+    {
+        if (space == APA102_Palette_Oklab)
+        {
+            const unsigned long linear[3] = { APA102_PALETTE_READ(&apa102_palette_linear[color->red]), APA102_PALETTE_READ(&apa102_palette_linear[color->green]), APA102_PALETTE_READ(&apa102_palette_linear[color->blue]) };
+
+            for (unsigned char i=0; i < 3; i++)
+            {
+                unsigned long lms = ((apa102_palette_lms[i][0] * linear[0]) + (apa102_palette_lms[i][1] * linear[1]) + (apa102_palette_lms[i][2] * linear[2]) + 0x2000) >> 14;
+
+                channels[i] = (signed int)apa102_palette_cbrt((lms > 0xFFFF) ? 0xFFFF : lms);
+            }
+        }
+        else
+        {
+            channels[0] = color->red;
+            channels[1] = color->green;
+            channels[2] = color->blue;
+        }
+        channels[3] = color->alpha;
+    }
+
+    static void apa102_palette_segment(const APA102_Palette_Stop *stops, unsigned char count, APA102_Palette_Space space, unsigned char position, APA102_Palette_Segment *segment)
+    {
+        unsigned char first = 0;
+
+        while (((first + 1) < count) && (stops[first + 1].position <= position))
+        {
+            first++;
+        }
+
+        apa102_palette_convert(&stops[first].color, space, segment->start);
+
+        if ((position < stops[0].position) || ((first + 1) >= count))
+        {
+            /* before the first or after the last stop */
+            for (unsigned char i=0; i < 4; i++)
+            {
+                segment->end[i] = segment->start[i];
+            }
+            segment->from = position;
+            segment->span = 0;
+            segment->last = (position < stops[0].position) ? (unsigned char)(stops[0].position - 1) : 0xFF;
+        }
+        else
+        {
+            apa102_palette_convert(&stops[first + 1].color, space, segment->end);
+            segment->from = stops[first].position;
+            segment->span = (unsigned char)(stops[first + 1].position - stops[first].position);
+            segment->last = (unsigned char)(stops[first + 1].position - 1);
+        }
+    }
+
+    static void apa102_palette_mix(const APA102_Palette_Segment *segment, APA102_Palette_Space space, unsigned char position, GFX_RGBA_Color *color)
+    {
+        const signed long weight = segment->span ? (signed long)(((((unsigned long)(position - segment->from)) << 12) + (segment->span >> 1)) / segment->span) : 0;
+        signed long channels[4];
+
+        /* weight in 1/4096, the channels of Oklab span up to 32767 */
+        for (unsigned char i=0; i < 4; i++)
+        {
+            channels[i] = segment->start[i] + ((((signed long)(segment->end[i] - segment->start[i]) * weight) + 0x800) >> 12);
+        }
+
+        if (space == APA102_Palette_Oklab)
+        {
+            signed long lms[3];
+
+            for (unsigned char i=0; i < 3; i++)
+            {
+                lms[i] = (signed long)apa102_palette_cube((unsigned long)channels[i]);
+            }
+
+            for (unsigned char i=0; i < 3; i++)
+            {
+                channels[i] = ((apa102_palette_rgb[i][0] * lms[0]) + (apa102_palette_rgb[i][1] * lms[1]) + (apa102_palette_rgb[i][2] * lms[2]) + 0x800) >> 12;
+                channels[i] = apa102_palette_gamma((channels[i] < 0) ? 0 : (unsigned long)channels[i]);
+            }
+        }
+
+        color->alpha = (unsigned char)channels[3];
+        color->red = (unsigned char)channels[0];
+        color->green = (unsigned char)channels[1];
+        color->blue = (unsigned char)channels[2];
+    }
+
+    /**
+     * @brief Interpolate the color of a gradient at a position.
+     *
+     * @param stops Pointer to the color stops (sorted by position).
+     * @param count Number of color stops (at least `1`).
+     * @param space Interpolation space.
+     * @param position Position in the gradient (`0` up to `255`).
+     * @param color Pointer where the interpolated color is stored.
+     *
+     * @details
+     * The stops are converted and interpolated on every call. Effects that map many LEDs should compile the gradient into a ramp with `apa102_palette_compile()`.
+     */
+    void apa102_palette_color(const APA102_Palette_Stop *stops, unsigned char count, APA102_Palette_Space space, unsigned char position, GFX_RGBA_Color *color)
+    {
+        APA102_Palette_Segment segment;
+
+        apa102_palette_segment(stops, count, space, position, &segment);
+        apa102_palette_mix(&segment, space, position, color);
+    }
+
+    /**
+     * @brief Compile a gradient into a ramp.
+     *
+     * @param ramp Pointer to the ramp that is filled.
+     * @param stops Pointer to the color stops (sorted by position).
+     * @param count Number of color stops (at least `1`).
+     * @param space Interpolation space.
+     *
+     * @details
+     * Every entry equals `apa102_palette_color()` at its position, the stops are converted once per segment. The ramp has to be compiled again if the color correction changes.
+     */
+    void apa102_palette_compile(APA102_Palette_Ramp *ramp, const APA102_Palette_Stop *stops, unsigned char count, APA102_Palette_Space space)
+    {
+        APA102_Palette_Segment segment;
+        unsigned int position = 0;
+
+        while (position < 256)
+        {
+            apa102_palette_segment(stops, count, space, (unsigned char)position, &segment);
+
+            for (; position <= segment.last; position++)
+            {
+                GFX_RGBA_Color color;
+
+                apa102_palette_mix(&segment, space, (unsigned char)position, &color);
+
+                #ifdef APA102_CALIBRATION_AVAILABLE
+                    ramp->colors[position] = color;
+                #else
+                    apa102_encode(0, APA102_START_FLAG | (0x3F & color.alpha), &color, ramp->frames[position]);
+                #endif
+            }
+        }
+    }
+
+    /**
+     * @brief Encode LEDs of a scalar field with a ramp into LED frames.
+     *
+     * @param ramp Pointer to the compiled ramp.
+     * @param values Pointer to the scalar field, one byte per LED.
+     * @param first Index of the first LED that is encoded (position on the strip).
+     * @param leds Number of LEDs that are encoded.
+     * @param frames Buffer with at least `leds * APA102_LED_FRAME_SIZE` bytes where the LED frames are stored.
+     *
+     * @details
+     * The LED `first + i` gets the ramp entry `values[first + i]`. Without per-LED calibration the LED frame is copied from the ramp, otherwise the color is encoded with `apa102_encode()`.
+     */
+    void apa102_palette_encode(const APA102_Palette_Ramp *ramp, const unsigned char *values, unsigned int first, unsigned int leds, unsigned char *frames)
+    {
+        for (unsigned int i=0; i < leds; i++)
+        {
+            #ifdef APA102_CALIBRATION_AVAILABLE
+                const GFX_RGBA_Color *color = &ramp->colors[values[first + i]];
+
+                apa102_encode(first + i, APA102_START_FLAG | (0x3F & color->alpha), color, frames);
+            #else
+                const unsigned char *frame = ramp->frames[values[first + i]];
+
+                for (unsigned char byte=0; byte < APA102_LED_FRAME_SIZE; byte++)
+                {
+                    frames[byte] = frame[byte];
+                }
+            #endif
+
+            frames += APA102_LED_FRAME_SIZE;
+        }
+    }
+
+    /**
+     * @brief Transmit a scalar field mapped through a ramp.
+     *
+     * @param ramp Pointer to the compiled ramp.
+     * @param values Pointer to the scalar field, one byte per LED.
+     * @param leds Number of LEDs.
+     *
+     * @details
+     * The function sends a complete LED data sequence. The LEDs are copied in chunks of `APA102_PALETTE_CHUNK` LEDs into a buffer on the stack and sent with `apa102_write()`.
+     */
+    void apa102_palette_show(const APA102_Palette_Ramp *ramp, const unsigned char *values, unsigned int leds)
+    {
+        unsigned char frames[APA102_PALETTE_CHUNK * APA102_LED_FRAME_SIZE];
+
+        APA102_SOF();
+
+        for (unsigned int first=0; first < leds; first += APA102_PALETTE_CHUNK)
+        {
+            unsigned int count = leds - first;
+
+            if (count > APA102_PALETTE_CHUNK)
+            {
+                count = APA102_PALETTE_CHUNK;
+            }
+
+            apa102_palette_encode(ramp, values, first, count, frames);
+            apa102_write(frames, count * APA102_LED_FRAME_SIZE);
+        }
+
+        APA102_EOF();
+    }
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file apa102_palette.h
+ * @brief Gradient palettes with precomputed ramps for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional gradient palettes. A gradient is defined by color stops and interpolated in RGB or in the perceptual Oklab space. It is compiled once into a ramp of 256 entries that already holds the LED frames, so mapping a scalar field (brightness, noise, heat) to colors is a single lookup per LED without any multiplication.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_PALETTE_H_
+#define APA102_PALETTE_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_PALETTE_READ
+        /**
+         * @def APA102_PALETTE_READ
+         * @brief Reads an entry (`unsigned int`) of the sRGB linearisation table.
+         *
+         * @details
+         * On platforms with memory mapped flash (e.g. avr0) the table can be accessed directly. Redefine this macro (e.g. with `pgm_read_word`) if the table is located in a separate address space.
+         */
+        #define APA102_PALETTE_READ(address) (*(address))
+    #endif
+
+    #ifndef APA102_PALETTE_CHUNK
+        /**
+         * @def APA102_PALETTE_CHUNK
+         * @brief Defines the number of LEDs copied at once by `apa102_palette_show()`.
+         */
+        #define APA102_PALETTE_CHUNK 16
+    #endif
+
+    /**
+     * @enum APA102_Palette_Space_t
+     * @brief Enumerates the color spaces in which the stops of a gradient are interpolated.
+     *
+     * @details
+     * `APA102_Palette_RGB` interpolates the sRGB values directly. `APA102_Palette_Oklab` interpolates in the perceptual Oklab space, which keeps the lightness of a gradient even and avoids dark or grey transitions between saturated colors.
+     */
+    enum APA102_Palette_Space_t
+    {
+        APA102_Palette_RGB=0,
+        APA102_Palette_Oklab
+    };
+    /**
+     * @typedef APA102_Palette_Space
+     * @brief Alias for enum APA102_Palette_Space_t representing the interpolation space of a gradient.
+     */
+    typedef enum APA102_Palette_Space_t APA102_Palette_Space;
+
+    /**
+     * @struct APA102_Palette_Stop_t
+     * @brief Color stop of a gradient.
+     *
+     * @details
+     * The stops of a gradient are sorted by `position` (`0` up to `255`). Entries before the first and after the last stop get the color of that stop, two stops at the same position form a hard edge. The intensity (alpha) is interpolated linearly.
+     */
+    struct APA102_Palette_Stop_t
+    {
+        unsigned char position;
+        GFX_RGBA_Color color;
+    };
+    /**
+     * @typedef APA102_Palette_Stop
+     * @brief Alias for struct APA102_Palette_Stop_t representing a color stop of a gradient.
+     */
+    typedef struct APA102_Palette_Stop_t APA102_Palette_Stop;
+
+    /**
+     * @struct APA102_Palette_Ramp_t
+     * @brief Compiled gradient with 256 entries.
+     *
+     * @details
+     * Without per-LED calibration the entries are LED frames encoded with `apa102_encode()` (including the color correction), otherwise the colors are stored and encoded per LED. The ramp needs `256 * APA102_LED_FRAME_SIZE` bytes (or `256 * sizeof(GFX_RGBA_Color)`) and is provided by the application.
+     */
+    struct APA102_Palette_Ramp_t
+    {
+        #ifdef APA102_CALIBRATION_AVAILABLE
+            GFX_RGBA_Color colors[256];
+        #else
+            unsigned char frames[256][APA102_LED_FRAME_SIZE];
+        #endif
+    };
+    /**
+     * @typedef APA102_Palette_Ramp
+     * @brief Alias for struct APA102_Palette_Ramp_t representing a compiled gradient.
+     */
+    typedef struct APA102_Palette_Ramp_t APA102_Palette_Ramp;
+
+    void apa102_palette_color(const APA102_Palette_Stop *stops, unsigned char count, APA102_Palette_Space space, unsigned char position, GFX_RGBA_Color *color);
+    void apa102_palette_compile(APA102_Palette_Ramp *ramp, const APA102_Palette_Stop *stops, unsigned char count, APA102_Palette_Space space);
+    void apa102_palette_encode(const APA102_Palette_Ramp *ramp, const unsigned char *values, unsigned int first, unsigned int leds, unsigned char *frames);
+    void apa102_palette_show(const APA102_Palette_Ramp *ramp, const unsigned char *values, unsigned int leds);
+
+#endif /* APA102_PALETTE_H_ */
@@ -0,0 +1,199 @@
+/**
+ * @file apa102_particle.c
+ * @brief Implementation of the particle engine.
+ *
+ * This source file implements the static particle pool. Living particles are kept at the beginning of the pool (a dying particle is replaced by the last one), so emitting, simulating and rendering only touch living particles. Every particle is split between the two LEDs next to its position (anti-aliasing) and added with saturation.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_particle.h"
+
+#ifdef APA102_PARTICLE_AVAILABLE
+
+    static APA102_Particle apa102_particle_pool[APA102_PARTICLE_POOL];
+    static unsigned int apa102_particle_living;
+    static unsigned int apa102_particle_seed = 0xACE1;
+
+    /* 16-bit xorshift */
+    static unsigned int apa102_particle_random(void)
+    {
+        unsigned int seed = apa102_particle_seed;
+
+        seed ^= (seed << 7) & 0xFFFF;
+        seed ^= seed >> 9;
+        seed ^= (seed << 8) & 0xFFFF;
+
+        apa102_particle_seed = seed;
+        return seed;
+    }
+
+    static unsigned char apa102_particle_saturate(unsigned char value, unsigned char color, unsigned char weight)
+    {
+        unsigned int sum = value + (((unsigned int)color * weight) >> 8);
+
+        return (sum > 0xFF) ? 0xFF : (unsigned char)sum;
+    }
+
+    static void apa102_particle_add(GFX_RGBA_Color *color, const APA102_Particle *particle, unsigned char weight)
+    {
+        color->red = apa102_particle_saturate(color->red, particle->red, weight);
+        color->green = apa102_particle_saturate(color->green, particle->green, weight);
+        color->blue = apa102_particle_saturate(color->blue, particle->blue, weight);
+    }
+
+    /**
+     * @brief Emit a particle.
+     *
+     * @param position Start position in 1/256 LED (see `APA102_PARTICLE_POSITION`).
+     * @param velocity Velocity in 1/256 LED per frame (negative values move towards the first LED).
+     * @param life Number of frames until the particle has faded out.
+     * @param color Pointer to the color of the particle at full brightness (the intensity is not used).
+     *
+     * @return `APA102_Particle_Ok` if the particle was emitted, `APA102_Particle_Full` if the pool is exhausted.
+     */
+    APA102_Particle_Status apa102_particle_emit(signed long position, signed int velocity, unsigned char life, const GFX_RGBA_Color *color)
+    {
+        if (apa102_particle_living >= APA102_PARTICLE_POOL)
+        {
+            return APA102_Particle_Full;
+        }
+
+        APA102_Particle *particle = &apa102_particle_pool[apa102_particle_living++];
+
+        particle->position = position;
+        particle->velocity = velocity;
+        particle->brightness = 0xFF;
+        particle->fade = life ? (unsigned char)((0xFFU + life - 1) / life) : 0xFF;
+        particle->red = color->red;
+        particle->green = color->green;
+        particle->blue = color->blue;
+
+        return APA102_Particle_Ok;
+    }
+
+    /**
+     * @brief Emit a burst of particles with random velocities (e.g. fireworks).
+     *
+     * @param position Start position of all particles in 1/256 LED.
+     * @param count Number of particles.
+     * @param speed Maximum speed in 1/256 LED per frame, the velocities are spread between `-speed` and `speed`.
+     * @param life Number of frames until the particles have faded out.
+     * @param color Pointer to the color of the particles.
+     *
+     * @return Number of emitted particles (less than `count` if the pool is exhausted).
+     */
+    unsigned char apa102_particle_burst(signed long position, unsigned char count, signed int speed, unsigned char life, const GFX_RGBA_Color *color)
+    {
+        unsigned char emitted = 0;
+
+        for (; emitted < count; emitted++)
+        {
+            signed int velocity = (signed int)((((signed long)(apa102_particle_random() & 0x1FF) - 0x100) * speed) >> 8);
+
+            if (apa102_particle_emit(position, velocity, life, color) != APA102_Particle_Ok)
+            {
+                break;
+            }
+        }
+        return emitted;
+    }
+
+    /**
+     * @brief Simulate one frame of all living particles.
+     *
+     * @param gravity Acceleration in 1/256 LED per frame squared (negative values pull towards the first LED).
+     * @param drag Velocity kept per frame (`0xFF` no drag, `0x80` halves the velocity).
+     * @param leds Length of the strip, particles leaving the strip die.
+     */
+    void apa102_particle_step(signed int gravity, unsigned char drag, unsigned int leds)
+    {
+        const signed long end = APA102_PARTICLE_POSITION(leds);
+        unsigned int i = 0;
+
+        while (i < apa102_particle_living)
+        {
+            APA102_Particle *particle = &apa102_particle_pool[i];
+            signed long velocity = (signed long)particle->velocity + gravity;
+
+            // The magnitude is scaled so that velocities in both directions decay towards 0 (an arithmetic shift of -1 stays -1)
+            if (velocity < 0)
+            {
+                particle->velocity = (signed int)-((-velocity * (drag + 1)) >> 8);
+            }
+            else
+            {
+                particle->velocity = (signed int)((velocity * (drag + 1)) >> 8);
+            }
+            particle->position += particle->velocity;
+
+            if ((particle->brightness <= particle->fade) || (particle->position < 0) || (particle->position >= end))
+            {
+                *particle = apa102_particle_pool[--apa102_particle_living];
+                continue;
+            }
+
+            particle->brightness -= particle->fade;
+            i++;
+        }
+    }
+
+    /**
+     * @brief Add all living particles to a color buffer.
+     *
+     * @param colors Pointer to the colors of the strip.
+     * @param leds Length of the strip.
+     *
+     * @details
+     * Every particle is split between the LED at its position and the next LED according to the fraction of the position. The colors are added with saturation, the intensity (alpha) of the LEDs is not changed. The buffer is usually cleared or faded by the application before.
+     */
+    void apa102_particle_render(GFX_RGBA_Color *colors, unsigned int leds)
+    {
+        for (unsigned int i=0; i < apa102_particle_living; i++)
+        {
+            const APA102_Particle *particle = &apa102_particle_pool[i];
+            unsigned int led = (unsigned int)(particle->position >> 8);
+            unsigned char next = (unsigned char)(((unsigned int)(particle->position & 0xFF) * particle->brightness) >> 8);
+
+            if (led >= leds)
+            {
+                continue;
+            }
+
+            apa102_particle_add(&colors[led], particle, particle->brightness - next);
+
+            if (next && ((led + 1) < leds))
+            {
+                apa102_particle_add(&colors[led + 1], particle, next);
+            }
+        }
+    }
+
+    /**
+     * @brief Read the number of living particles.
+     *
+     * @return Number of living particles.
+     */
+    unsigned int apa102_particle_count(void)
+    {
+        return apa102_particle_living;
+    }
+
+    /**
+     * @brief Remove all particles.
+     */
+    void apa102_particle_clear(void)
+    {
+        apa102_particle_living = 0;
+    }
+
+#endif
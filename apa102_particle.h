@@ -0,0 +1,89 @@
+/**
+ * @file apa102_particle.h
+ * @brief Particle engine for LED effects of the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional particle engine. Particles (sparks, comets, fireworks) live in a static pool, move with fixed-point physics (positions and velocities in 1/256 LED) and are added with anti-aliasing to a color buffer before it is sent. Every frame costs time proportional to the number of living particles, not to the length of the strip, and no heap is used.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_PARTICLE_H_
+#define APA102_PARTICLE_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_PARTICLE_POOL
+        /**
+         * @def APA102_PARTICLE_POOL
+         * @brief Defines the maximum number of living particles.
+         */
+        #define APA102_PARTICLE_POOL 32
+    #endif
+
+    /**
+     * @def APA102_PARTICLE_POSITION
+     * @brief Converts a LED position into the fixed-point position of a particle.
+     */
+    #define APA102_PARTICLE_POSITION(led) ((signed long)(led) << 8)
+
+    /**
+     * @struct APA102_Particle_t
+     * @brief State of a particle.
+     *
+     * @details
+     * `position` (24.8) and `velocity` (8.8, per frame) are in 1/256 LED. The brightness decreases by `fade` every frame, the particle dies when it reaches `0`.
+     */
+    struct APA102_Particle_t
+    {
+        signed long position;
+        signed int velocity;
+        unsigned char brightness;
+        unsigned char fade;
+        unsigned char red;
+        unsigned char green;
+        unsigned char blue;
+    };
+    /**
+     * @typedef APA102_Particle
+     * @brief Alias for struct APA102_Particle_t representing the state of a particle.
+     */
+    typedef struct APA102_Particle_t APA102_Particle;
+
+    /**
+     * @def APA102_PARTICLE_RAM
+     * @brief Static RAM in bytes used by the particle engine (pool, number of living particles and random state).
+     */
+    #define APA102_PARTICLE_RAM ((APA102_PARTICLE_POOL * sizeof(APA102_Particle)) + (2 * sizeof(unsigned int)))
+
+    /**
+     * @enum APA102_Particle_Status_t
+     * @brief Enumerates the results of emitting a particle.
+     */
+    enum APA102_Particle_Status_t
+    {
+        APA102_Particle_Ok=0,
+        APA102_Particle_Full
+    };
+    /**
+     * @typedef APA102_Particle_Status
+     * @brief Alias for enum APA102_Particle_Status_t representing the result of emitting a particle.
+     */
+    typedef enum APA102_Particle_Status_t APA102_Particle_Status;
+
+    APA102_Particle_Status apa102_particle_emit(signed long position, signed int velocity, unsigned char life, const GFX_RGBA_Color *color);
+    unsigned char apa102_particle_burst(signed long position, unsigned char count, signed int speed, unsigned char life, const GFX_RGBA_Color *color);
+    void apa102_particle_step(signed int gravity, unsigned char drag, unsigned int leds);
+    void apa102_particle_render(GFX_RGBA_Color *colors, unsigned int leds);
+    unsigned int apa102_particle_count(void);
+    void apa102_particle_clear(void);
+
+#endif /* APA102_PARTICLE_H_ */
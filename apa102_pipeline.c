@@ -0,0 +1,328 @@
+/**
+ * @file apa102_pipeline.c
+ * @brief Implementation of the fused pixel pipeline.
+ *
+ * This source file implements the per-LED loop of the fused pixel pipeline. Every stage is a macro that expands to nothing if the stage is not selected, so the loop only contains the selected stages. White balance, dimmer and power limit are combined into one factor per channel at the beginning of a frame, the power limit from the load measured for the same frame.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_pipeline.h"
+
+#ifdef APA102_PIPELINE_AVAILABLE
+
+    #if defined(APA102_PIPELINE_WHITE) || defined(APA102_PIPELINE_DIMMER) || defined(APA102_PIPELINE_POWER)
+        #define APA102_PIPELINE_SCALE
+    #endif
+
+    #if (APA102_FRAME_FORMAT == APA102_FORMAT_APA102) && !defined(APA102_CORRECTION_AVAILABLE) && !defined(APA102_CALIBRATION_AVAILABLE)
+        #define APA102_PIPELINE_DIRECT
+    #endif
+
+    static unsigned int apa102_pipeline_factor[3] = { 256, 256, 256 };
+    static unsigned char apa102_pipeline_white_point[3] = { 0xFF, 0xFF, 0xFF };
+    static unsigned char apa102_pipeline_level = 0xFF;
+    static unsigned int apa102_pipeline_budget;
+    static unsigned long apa102_pipeline_estimate;
+
+    #ifdef APA102_PIPELINE_POWER
+        static unsigned int apa102_pipeline_scale = 256;
+        static unsigned int apa102_pipeline_base[3];
+        static unsigned long apa102_pipeline_load[3];
+    #endif
+
+    #ifdef APA102_PIPELINE_GAMMA
+        static const unsigned char apa102_pipeline_gamma[256] = {
+              0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+              1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+              3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+              6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+             12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+             20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+             30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+             42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+             56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+             73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+             91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+            113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+            137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+            163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+            192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+            223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255
+        };
+
+        #define APA102_PIPELINE_STAGE_GAMMA(value) { value = APA102_PIPELINE_GAMMA_READ(&apa102_pipeline_gamma[value]); }
+    #else
+        #define APA102_PIPELINE_STAGE_GAMMA(value)
+    #endif
+
+    #ifdef APA102_PIPELINE_SCALE
+        #define APA102_PIPELINE_STAGE_SCALE(value, channel) { value = (value * apa102_pipeline_factor[channel]) >> 8; }
+    #else
+        #define APA102_PIPELINE_STAGE_SCALE(value, channel)
+    #endif
+
+    #ifdef APA102_PIPELINE_POWER
+        #define APA102_PIPELINE_STAGE_LOAD(value, channel, alpha) { load[channel] += (unsigned long)value * (alpha & APA102_MAX_INTENSITY); }
+    #else
+        #define APA102_PIPELINE_STAGE_LOAD(value, channel, alpha)
+    #endif
+
+    #ifdef APA102_PIPELINE_DIRECT
+        #define APA102_PIPELINE_STAGE_ENCODE(led, alpha, red, green, blue, frame) \
+            { \
+                (frame)[0] = APA102_START_FLAG | (alpha & APA102_MAX_INTENSITY); \
+                (frame)[1] = (unsigned char)blue; \
+                (frame)[2] = (unsigned char)green; \
+                (frame)[3] = (unsigned char)red; \
+            }
+    #else
+        #define APA102_PIPELINE_STAGE_ENCODE(led, alpha, red, green, blue, frame) \
+            { \
+                GFX_RGBA_Color result = { alpha, (unsigned char)red, (unsigned char)green, (unsigned char)blue }; \
+                apa102_encode(led, APA102_START_FLAG | (0x3F & alpha), &result, frame); \
+            }
+    #endif
+
+    /**
+     * @brief Set the white balance of the pipeline.
+     *
+     * @param red Scale of the red channel, `0xFF` leaves the channel unchanged.
+     * @param green Scale of the green channel.
+     * @param blue Scale of the blue channel.
+     *
+     * @note The setting takes effect with the next `apa102_pipeline_begin()` and only if `APA102_PIPELINE_WHITE` is selected.
+     */
+    void apa102_pipeline_white(unsigned char red, unsigned char green, unsigned char blue)
+    {
+        apa102_pipeline_white_point[0] = red;
+        apa102_pipeline_white_point[1] = green;
+        apa102_pipeline_white_point[2] = blue;
+    }
+
+    /**
+     * @brief Set the master dimmer of the pipeline.
+     *
+     * @param level Brightness of all channels, `0xFF` leaves the channels unchanged.
+     *
+     * @note The setting takes effect with the next `apa102_pipeline_begin()` and only if `APA102_PIPELINE_DIMMER` is selected.
+     */
+    void apa102_pipeline_dimmer(unsigned char level)
+    {
+        apa102_pipeline_level = level;
+    }
+
+    /**
+     * @brief Set the current budget of the power limit.
+     *
+     * @param milliamps Maximum current of the strip in mA, `0` disables the limit.
+     *
+     * @note The setting takes effect with the next `apa102_pipeline_begin()` and only if `APA102_PIPELINE_POWER` is selected.
+     */
+    void apa102_pipeline_power(unsigned int milliamps)
+    {
+        apa102_pipeline_budget = milliamps;
+    }
+
+    /**
+     * @brief Read the estimated current of the current frame.
+     *
+     * @return Current in mA the frame started by the last `apa102_pipeline_begin()` would draw without power limit (`0` if `APA102_PIPELINE_POWER` is not selected).
+     */
+    unsigned long apa102_pipeline_current(void)
+    {
+        return apa102_pipeline_estimate;
+    }
+
+    /**
+     * @brief Measure the load of LEDs of the next frame.
+     *
+     * @param colors Pointer to the colors of the LEDs.
+     * @param leds Number of LEDs.
+     *
+     * @details
+     * The load of every channel (after the gamma stage, weighted with the global brightness) is accumulated for the power limit of the next `apa102_pipeline_begin()`. A frame can be measured in multiple calls, all LEDs of the frame have to be measured before `apa102_pipeline_begin()`.
+     *
+     * @note The function does nothing if `APA102_PIPELINE_POWER` is not selected.
+     */
+    void apa102_pipeline_measure(const GFX_RGBA_Color *colors, unsigned int leds)
+    {
+        #ifdef APA102_PIPELINE_POWER
+            unsigned long load[3] = { 0, 0, 0 };
+
+            for (unsigned int i=0; i < leds; i++)
+            {
+                unsigned char alpha = colors[i].alpha;
+                unsigned int red = colors[i].red;
+                unsigned int green = colors[i].green;
+                unsigned int blue = colors[i].blue;
+
+                APA102_PIPELINE_STAGE_GAMMA(red);
+                APA102_PIPELINE_STAGE_GAMMA(green);
+                APA102_PIPELINE_STAGE_GAMMA(blue);
+
+                APA102_PIPELINE_STAGE_LOAD(red, 0, alpha);
+                APA102_PIPELINE_STAGE_LOAD(green, 1, alpha);
+                APA102_PIPELINE_STAGE_LOAD(blue, 2, alpha);
+            }
+
+            apa102_pipeline_load[0] += load[0];
+            apa102_pipeline_load[1] += load[1];
+            apa102_pipeline_load[2] += load[2];
+        #else
+            (void)colors;
+            (void)leds;
+        #endif
+    }
+
+    /**
+     * @brief Start a frame of the pipeline.
+     *
+     * @details
+     * The factors of white balance, dimmer and power limit are combined into one factor per channel. The current of the frame is estimated from the load measured with `apa102_pipeline_measure()` and the factors of white balance and dimmer, the power limit scales the frame down if the estimate exceeds the budget.
+     */
+    void apa102_pipeline_begin(void)
+    {
+        #ifdef APA102_PIPELINE_POWER
+            unsigned long current = 0;
+        #endif
+
+        for (unsigned char channel=0; channel < 3; channel++)
+        {
+            unsigned long factor = 256;
+
+            #ifdef APA102_PIPELINE_WHITE
+                factor = (factor * (apa102_pipeline_white_point[channel] + 1UL)) >> 8;
+            #endif
+            #ifdef APA102_PIPELINE_DIMMER
+                factor = (factor * (apa102_pipeline_level + 1UL)) >> 8;
+            #endif
+            #ifdef APA102_PIPELINE_POWER
+                apa102_pipeline_base[channel] = (unsigned int)factor;
+
+                current += ((apa102_pipeline_load[channel] + 254UL) / 255UL) * factor;
+            #endif
+
+            apa102_pipeline_factor[channel] = (unsigned int)factor;
+        }
+
+        #ifdef APA102_PIPELINE_POWER
+            apa102_pipeline_estimate = ((((current + 255UL) >> 8) * APA102_PIPELINE_CURRENT) + (APA102_MAX_INTENSITY - 1)) / APA102_MAX_INTENSITY;
+            apa102_pipeline_scale = 256;
+
+            if (apa102_pipeline_budget && (apa102_pipeline_estimate > apa102_pipeline_budget))
+            {
+                apa102_pipeline_scale = (unsigned int)(((unsigned long)apa102_pipeline_budget * 256UL) / apa102_pipeline_estimate);
+
+                if (!apa102_pipeline_scale)
+                {
+                    apa102_pipeline_scale = 1;
+                }
+
+                for (unsigned char channel=0; channel < 3; channel++)
+                {
+                    apa102_pipeline_factor[channel] = (unsigned int)(((unsigned long)apa102_pipeline_base[channel] * apa102_pipeline_scale) >> 8);
+                }
+            }
+        #endif
+    }
+
+    /**
+     * @brief Run the pipeline over LEDs of a color buffer.
+     *
+     * @param colors Pointer to the colors of the LEDs.
+     * @param first Position on the strip of the first LED.
+     * @param leds Number of LEDs.
+     * @param frames Buffer with at least `leds * APA102_LED_FRAME_SIZE` bytes where the LED frames are stored.
+     *
+     * @details
+     * Every LED runs through the selected stages and is written as LED frame in one step. Without enabled color stages of the driver and with `APA102_FORMAT_APA102` the LED frame is written directly, otherwise it is encoded with `apa102_encode()`. A frame can be encoded in multiple calls between `apa102_pipeline_begin()` and `apa102_pipeline_end()`.
+     */
+    void apa102_pipeline_encode(const GFX_RGBA_Color *colors, unsigned int first, unsigned int leds, unsigned char *frames)
+    {
+        for (unsigned int i=0; i < leds; i++)
+        {
+            unsigned char alpha = colors[i].alpha;
+            unsigned int red = colors[i].red;
+            unsigned int green = colors[i].green;
+            unsigned int blue = colors[i].blue;
+
+            APA102_PIPELINE_STAGE_GAMMA(red);
+            APA102_PIPELINE_STAGE_GAMMA(green);
+            APA102_PIPELINE_STAGE_GAMMA(blue);
+
+            APA102_PIPELINE_STAGE_SCALE(red, 0);
+            APA102_PIPELINE_STAGE_SCALE(green, 1);
+            APA102_PIPELINE_STAGE_SCALE(blue, 2);
+
+            APA102_PIPELINE_STAGE_ENCODE(first + i, alpha, red, green, blue, frames);
+
+            frames += APA102_LED_FRAME_SIZE;
+        }
+
+        #ifdef APA102_PIPELINE_DIRECT
+            (void)first;
+        #endif
+    }
+
+    /**
+     * @brief Finish a frame of the pipeline.
+     *
+     * @details
+     * The measured load is cleared, so the next frame can be measured with `apa102_pipeline_measure()`.
+     */
+    void apa102_pipeline_end(void)
+    {
+        #ifdef APA102_PIPELINE_POWER
+            apa102_pipeline_load[0] = 0;
+            apa102_pipeline_load[1] = 0;
+            apa102_pipeline_load[2] = 0;
+        #endif
+    }
+
+    /**
+     * @brief Transmit a color buffer through the pipeline.
+     *
+     * @param colors Pointer to the colors of the LEDs.
+     * @param leds Number of LEDs.
+     *
+     * @details
+     * The function sends a complete LED data sequence. The load of the colors is measured first, so the power limit applies to the same frame. The LEDs are encoded in chunks of `APA102_PIPELINE_CHUNK` LEDs into a buffer on the stack and sent with `apa102_write()`.
+     */
+    void apa102_pipeline_show(const GFX_RGBA_Color *colors, unsigned int leds)
+    {
+        unsigned char frames[APA102_PIPELINE_CHUNK * APA102_LED_FRAME_SIZE];
+
+        apa102_pipeline_measure(colors, leds);
+        apa102_pipeline_begin();
+
+        APA102_SOF();
+
+        for (unsigned int first=0; first < leds; first += APA102_PIPELINE_CHUNK)
+        {
+            unsigned int count = leds - first;
+
+            if (count > APA102_PIPELINE_CHUNK)
+            {
+                count = APA102_PIPELINE_CHUNK;
+            }
+
+            apa102_pipeline_encode(&colors[first], first, count, frames);
+            apa102_write(frames, count * APA102_LED_FRAME_SIZE);
+        }
+
+        APA102_EOF();
+
+        apa102_pipeline_end();
+    }
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file apa102_pipeline.h
+ * @brief Fused pixel pipeline for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional fused pixel pipeline. The color stages (gamma, white balance, master dimmer, power limiting) are selected with configuration macros and compiled into a single per-LED loop that writes the LED frames directly. Stages that are not selected are removed at compile time, the per-frame factors of white balance, dimmer and power limit are folded into one multiplication per channel.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_PIPELINE_H_
+#define APA102_PIPELINE_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_PIPELINE_GAMMA
+        /**
+         * @def APA102_PIPELINE_GAMMA
+         * @brief Stage mapping every channel through a gamma 2.2 table.
+         *
+         * @note Set this macro as a global compiler symbol to select the stage.
+         */
+        //#define APA102_PIPELINE_GAMMA
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PIPELINE_GAMMA
+        #endif
+    #endif
+
+    #ifndef APA102_PIPELINE_WHITE
+        /**
+         * @def APA102_PIPELINE_WHITE
+         * @brief Stage scaling every channel with the white balance set by `apa102_pipeline_white()`.
+         *
+         * @note Set this macro as a global compiler symbol to select the stage.
+         */
+        //#define APA102_PIPELINE_WHITE
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PIPELINE_WHITE
+        #endif
+    #endif
+
+    #ifndef APA102_PIPELINE_DIMMER
+        /**
+         * @def APA102_PIPELINE_DIMMER
+         * @brief Stage scaling all channels with the master dimmer set by `apa102_pipeline_dimmer()`.
+         *
+         * @note Set this macro as a global compiler symbol to select the stage.
+         */
+        //#define APA102_PIPELINE_DIMMER
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PIPELINE_DIMMER
+        #endif
+    #endif
+
+    #ifndef APA102_PIPELINE_POWER
+        /**
+         * @def APA102_PIPELINE_POWER
+         * @brief Stage limiting the current of the strip to the budget set by `apa102_pipeline_power()`.
+         *
+         * @details
+         * The current is estimated from the load of every channel, measured with `apa102_pipeline_measure()` before the frame is started. The limit of a frame is derived from the estimate of the same frame, so a change from black to full brightness never exceeds the budget.
+         *
+         * @note Set this macro as a global compiler symbol to select the stage.
+         */
+        //#define APA102_PIPELINE_POWER
+
+        #ifdef _DOXYGEN_    // Used for documentation, can be ignored
+            #define APA102_PIPELINE_POWER
+        #endif
+    #endif
+
+    #ifndef APA102_PIPELINE_CURRENT
+        /**
+         * @def APA102_PIPELINE_CURRENT
+         * @brief Defines the current in mA of a single channel at full color and intensity.
+         */
+        #define APA102_PIPELINE_CURRENT 20UL
+    #endif
+
+    #ifndef APA102_PIPELINE_GAMMA_READ
+        /**
+         * @def APA102_PIPELINE_GAMMA_READ
+         * @brief Reads an entry of the gamma table.
+         *
+         * @details
+         * On platforms with memory mapped flash (e.g. avr0) the table can be accessed directly. Redefine this macro (e.g. with `pgm_read_byte`) if the table is located in a separate address space.
+         */
+        #define APA102_PIPELINE_GAMMA_READ(address) (*(address))
+    #endif
+
+    #ifndef APA102_PIPELINE_CHUNK
+        /**
+         * @def APA102_PIPELINE_CHUNK
+         * @brief Defines the number of LEDs encoded at once by `apa102_pipeline_show()`.
+         */
+        #define APA102_PIPELINE_CHUNK 16
+    #endif
+
+    /**
+     * @def APA102_PIPELINE_RAM
+     * @brief Static RAM in bytes used by the fused pixel pipeline (settings, per-frame factors and current estimate).
+     */
+    #define APA102_PIPELINE_RAM ((2 * sizeof(unsigned int[3])) + sizeof(unsigned char[4]) + (2 * sizeof(unsigned int)) + sizeof(unsigned long[4]))
+
+    void apa102_pipeline_white(unsigned char red, unsigned char green, unsigned char blue);
+    void apa102_pipeline_dimmer(unsigned char level);
+    void apa102_pipeline_power(unsigned int milliamps);
+    unsigned long apa102_pipeline_current(void);
+    void apa102_pipeline_measure(const GFX_RGBA_Color *colors, unsigned int leds);
+    void apa102_pipeline_begin(void);
+    void apa102_pipeline_encode(const GFX_RGBA_Color *colors, unsigned int first, unsigned int leds, unsigned char *frames);
+    void apa102_pipeline_end(void);
+    void apa102_pipeline_show(const GFX_RGBA_Color *colors, unsigned int leds);
+
+#endif /* APA102_PIPELINE_H_ */
@@ -0,0 +1,177 @@
+/**
+ * @file apa102_planar.c
+ * @brief Implementation of the planar render buffers.
+ *
+ * This source file implements the planar-to-interleaved encoder. Without color stages and with `APA102_FORMAT_APA102` the planes are interleaved directly into `[header, blue, green, red]` frames: 16 LEDs per step with SSE2 (`punpck` byte/word unpacking) or NEON (`vst4q_u8`), 4 LEDs per step otherwise. With enabled color stages or other frame formats every LED is encoded with `apa102_encode()`.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_planar.h"
+
+#ifdef APA102_PLANAR_AVAILABLE
+
+    #if (APA102_FRAME_FORMAT == APA102_FORMAT_APA102) && !defined(APA102_CORRECTION_AVAILABLE) && !defined(APA102_CALIBRATION_AVAILABLE)
+
+        #if defined(__SSE2__)
+            #include <emmintrin.h>
+        #elif defined(__ARM_NEON)
+            #include <arm_neon.h>
+        #endif
+
+        static unsigned int apa102_planar_vector(const APA102_Planar *planar, unsigned int first, unsigned int leds, unsigned char *frames)
+        {
+            unsigned int i = 0;
+
+            #if defined(__SSE2__)
+                const __m128i flag = _mm_set1_epi8((char)APA102_START_FLAG);
+                const __m128i mask = _mm_set1_epi8(APA102_MAX_INTENSITY);
+                __m128i header = _mm_set1_epi8((char)(APA102_START_FLAG | (planar->intensity & APA102_MAX_INTENSITY)));
+
+                for (; (i + 16) <= leds; i += 16)
+                {
+                    const unsigned int led = first + i;
+                    const __m128i red = _mm_loadu_si128((const __m128i *)&planar->red[led]);
+                    const __m128i green = _mm_loadu_si128((const __m128i *)&planar->green[led]);
+                    const __m128i blue = _mm_loadu_si128((const __m128i *)&planar->blue[led]);
+
+                    if (planar->alpha)
+                    {
+                        header = _mm_or_si128(flag, _mm_and_si128(mask, _mm_loadu_si128((const __m128i *)&planar->alpha[led])));
+                    }
+
+                    const __m128i low_hb = _mm_unpacklo_epi8(header, blue);
+                    const __m128i high_hb = _mm_unpackhi_epi8(header, blue);
+                    const __m128i low_gr = _mm_unpacklo_epi8(green, red);
+                    const __m128i high_gr = _mm_unpackhi_epi8(green, red);
+
+                    _mm_storeu_si128((__m128i *)&frames[(i * 4)], _mm_unpacklo_epi16(low_hb, low_gr));
+                    _mm_storeu_si128((__m128i *)&frames[(i * 4) + 16], _mm_unpackhi_epi16(low_hb, low_gr));
+                    _mm_storeu_si128((__m128i *)&frames[(i * 4) + 32], _mm_unpacklo_epi16(high_hb, high_gr));
+                    _mm_storeu_si128((__m128i *)&frames[(i * 4) + 48], _mm_unpackhi_epi16(high_hb, high_gr));
+                }
+            #elif defined(__ARM_NEON)
+                const uint8x16_t flag = vdupq_n_u8(APA102_START_FLAG);
+                const uint8x16_t mask = vdupq_n_u8(APA102_MAX_INTENSITY);
+                uint8x16x4_t frame;
+
+                frame.val[0] = vdupq_n_u8(APA102_START_FLAG | (planar->intensity & APA102_MAX_INTENSITY));
+
+                for (; (i + 16) <= leds; i += 16)
+                {
+                    const unsigned int led = first + i;
+
+                    if (planar->alpha)
+                    {
+                        frame.val[0] = vorrq_u8(flag, vandq_u8(mask, vld1q_u8(&planar->alpha[led])));
+                    }
+                    frame.val[1] = vld1q_u8(&planar->blue[led]);
+                    frame.val[2] = vld1q_u8(&planar->green[led]);
+                    frame.val[3] = vld1q_u8(&planar->red[led]);
+
+                    vst4q_u8(&frames[i * 4], frame);
+                }
+            #else
+                (void)planar;
+                (void)first;
+                (void)leds;
+                (void)frames;
+            #endif
+
+            return i;
+        }
+
+        #define APA102_PLANAR_FRAME(index) \
+            { \
+                unsigned int led = first + (index); \
+                frames[((index) * 4)] = planar->alpha ? (APA102_START_FLAG | (planar->alpha[led] & APA102_MAX_INTENSITY)) : header; \
+                frames[((index) * 4) + 1] = planar->blue[led]; \
+                frames[((index) * 4) + 2] = planar->green[led]; \
+                frames[((index) * 4) + 3] = planar->red[led]; \
+            }
+
+        static void apa102_planar_direct(const APA102_Planar *planar, unsigned int first, unsigned int leds, unsigned char *frames)
+        {
+            const unsigned char header = APA102_START_FLAG | (planar->intensity & APA102_MAX_INTENSITY);
+            unsigned int i = apa102_planar_vector(planar, first, leds, frames);
+
+            for (; (i + 4) <= leds; i += 4)
+            {
+                APA102_PLANAR_FRAME(i);
+                APA102_PLANAR_FRAME(i + 1);
+                APA102_PLANAR_FRAME(i + 2);
+                APA102_PLANAR_FRAME(i + 3);
+            }
+            for (; i < leds; i++)
+            {
+                APA102_PLANAR_FRAME(i);
+            }
+        }
+    #endif
+
+    /**
+     * @brief Encode LEDs of a planar render buffer into interleaved LED frames.
+     *
+     * @param planar Pointer to the planar render buffer.
+     * @param first Index of the first LED that is encoded (position on the strip).
+     * @param leds Number of LEDs that are encoded.
+     * @param frames Buffer with at least `leds * APA102_LED_FRAME_SIZE` bytes where the LED frames are stored.
+     *
+     * @details
+     * The LED frames are equal to the frames `apa102_led()` sends for the same colors. Without enabled color stages and with `APA102_FORMAT_APA102` the planes are interleaved directly (SIMD on hosts), otherwise every LED is encoded with `apa102_encode()`.
+     */
+    void apa102_planar_encode(const APA102_Planar *planar, unsigned int first, unsigned int leds, unsigned char *frames)
+    {
+        #if (APA102_FRAME_FORMAT == APA102_FORMAT_APA102) && !defined(APA102_CORRECTION_AVAILABLE) && !defined(APA102_CALIBRATION_AVAILABLE)
+            apa102_planar_direct(planar, first, leds, frames);
+        #else
+            for (unsigned int i=0; i < leds; i++)
+            {
+                unsigned int led = first + i;
+                GFX_RGBA_Color color = { planar->alpha ? planar->alpha[led] : planar->intensity, planar->red[led], planar->green[led], planar->blue[led] };
+
+                apa102_encode(led, APA102_START_FLAG | (0x3F & color.alpha), &color, &frames[i * APA102_LED_FRAME_SIZE]);
+            }
+        #endif
+    }
+
+    /**
+     * @brief Transmit a planar render buffer.
+     *
+     * @param planar Pointer to the planar render buffer.
+     *
+     * @details
+     * The function sends a complete LED data sequence. The LEDs are encoded in chunks of `APA102_PLANAR_CHUNK` LEDs into a buffer on the stack and sent with `apa102_write()`.
+     */
+    void apa102_planar_show(const APA102_Planar *planar)
+    {
+        unsigned char frames[APA102_PLANAR_CHUNK * APA102_LED_FRAME_SIZE];
+
+        APA102_SOF();
+
+        for (unsigned int first=0; first < planar->leds; first += APA102_PLANAR_CHUNK)
+        {
+            unsigned int leds = planar->leds - first;
+
+            if (leds > APA102_PLANAR_CHUNK)
+            {
+                leds = APA102_PLANAR_CHUNK;
+            }
+
+            apa102_planar_encode(planar, first, leds, frames);
+            apa102_write(frames, leds * APA102_LED_FRAME_SIZE);
+        }
+
+        APA102_EOF();
+    }
+
+#endif
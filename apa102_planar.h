@@ -0,0 +1,60 @@
+/**
+ * @file apa102_planar.h
+ * @brief Planar (structure-of-arrays) render buffers for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional planar render buffers. Effects work on separate red, green and blue planes (and an optional intensity plane), which compilers can vectorise. The encoder interleaves the planes into LED frames with SIMD instructions on hosts (SSE2, NEON) and an unrolled loop on microcontrollers.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_PLANAR_H_
+#define APA102_PLANAR_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_PLANAR_CHUNK
+        /**
+         * @def APA102_PLANAR_CHUNK
+         * @brief Defines the number of LEDs encoded at once by `apa102_planar_show()`.
+         *
+         * @details
+         * The LED frames of a chunk are encoded into a buffer on the stack (`APA102_PLANAR_CHUNK * APA102_LED_FRAME_SIZE` bytes) and sent with `apa102_write()`.
+         */
+        #define APA102_PLANAR_CHUNK 16
+    #endif
+
+    /**
+     * @struct APA102_Planar_t
+     * @brief Planar render buffer.
+     *
+     * @details
+     * The planes `red`, `green` and `blue` hold one byte per LED. If `alpha` is `0` every LED uses the global `intensity`, otherwise the plane holds the intensity of every LED.
+     */
+    struct APA102_Planar_t
+    {
+        unsigned char *red;
+        unsigned char *green;
+        unsigned char *blue;
+        unsigned char *alpha;
+        unsigned char intensity;
+        unsigned int leds;
+    };
+    /**
+     * @typedef APA102_Planar
+     * @brief Alias for struct APA102_Planar_t representing a planar render buffer.
+     */
+    typedef struct APA102_Planar_t APA102_Planar;
+
+    void apa102_planar_encode(const APA102_Planar *planar, unsigned int first, unsigned int leds, unsigned char *frames);
+    void apa102_planar_show(const APA102_Planar *planar);
+
+#endif /* APA102_PLANAR_H_ */
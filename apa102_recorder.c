@@ -0,0 +1,238 @@
+/**
+ * @file apa102_recorder.c
+ * @brief Implementation of the SPI byte stream recorder.
+ *
+ * This source file implements the capture file writer (Linux) and the RAM ring buffer (microcontrollers) of the frame recorder. The driver calls `apa102_recorder_begin()` on every start-of-frame, `apa102_recorder_write()` for every transmitted byte and `apa102_recorder_end()` after every end-of-frame.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+// clock_gettime() of the Linux recorder is not declared in strict ISO C modes (e.g. -std=c11)
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "apa102_recorder.h"
+
+#ifdef APA102_RECORDER_AVAILABLE
+
+    #ifdef __linux__
+
+        #include <stdio.h>
+        #include <time.h>
+
+        static FILE *apa102_recorder_file;
+        static unsigned char apa102_recorder_buffer[APA102_RECORDER_BUFFER_SIZE];
+        static unsigned long apa102_recorder_length;
+        static unsigned long long apa102_recorder_timestamp;
+
+        static unsigned long long apa102_recorder_now(void)
+        {
+            struct timespec now;
+
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            return ((unsigned long long)now.tv_sec * 1000000000ULL) + (unsigned long long)now.tv_nsec;
+        }
+
+        static void apa102_recorder_flush(void)
+        {
+            unsigned char header[20];
+            unsigned long long end = apa102_recorder_now();
+
+            if (!apa102_recorder_file || !apa102_recorder_length)
+            {
+                return;
+            }
+
+            for (unsigned char i=0; i < 8; i++)
+            {
+                header[i] = (unsigned char)(apa102_recorder_timestamp >> (8 * i));
+                header[8 + i] = (unsigned char)(end >> (8 * i));
+            }
+            for (unsigned char i=0; i < 4; i++)
+            {
+                header[16 + i] = (unsigned char)(apa102_recorder_length >> (8 * i));
+            }
+
+            fwrite(header, 1, sizeof(header), apa102_recorder_file);
+            fwrite(apa102_recorder_buffer, 1, apa102_recorder_length, apa102_recorder_file);
+
+            apa102_recorder_length = 0;
+            apa102_recorder_timestamp = end;
+        }
+
+        /**
+         * @brief Open a capture file and start recording.
+         *
+         * @param path Path of the capture file. An existing file is overwritten.
+         *
+         * @return `APA102_Recorder_Ok` if the file was created, otherwise `APA102_Recorder_Error`.
+         *
+         * @details
+         * A previously opened capture file is closed first. The file header contains the frame format, so the decoder can select the matching LED frame layout.
+         */
+        APA102_Recorder_Status apa102_recorder_open(const char *path)
+        {
+            const unsigned char header[8] = { 'A', '1', '0', '2', APA102_RECORDER_VERSION, APA102_FRAME_FORMAT, 0x00, 0x00 };
+
+            apa102_recorder_close();
+            apa102_recorder_file = fopen(path, "wb");
+
+            if (!apa102_recorder_file)
+            {
+                return APA102_Recorder_Error;
+            }
+            if (fwrite(header, 1, sizeof(header), apa102_recorder_file) != sizeof(header))
+            {
+                fclose(apa102_recorder_file);
+                apa102_recorder_file = 0;
+                return APA102_Recorder_Error;
+            }
+
+            apa102_recorder_length = 0;
+            apa102_recorder_timestamp = apa102_recorder_now();
+
+            return APA102_Recorder_Ok;
+        }
+
+        /**
+         * @brief Write pending bytes and close the capture file.
+         */
+        void apa102_recorder_close(void)
+        {
+            if (apa102_recorder_file)
+            {
+                apa102_recorder_flush();
+                fclose(apa102_recorder_file);
+                apa102_recorder_file = 0;
+            }
+        }
+
+        /**
+         * @brief Start a new record (called on every start-of-frame).
+         *
+         * @details
+         * Pending bytes that were sent without a start-of-frame are written as a separate record. The timestamp of the new record is taken now.
+         */
+        void apa102_recorder_begin(void)
+        {
+            apa102_recorder_flush();
+            apa102_recorder_timestamp = apa102_recorder_now();
+        }
+
+        /**
+         * @brief Finish the current record (called after every end-of-frame).
+         */
+        void apa102_recorder_end(void)
+        {
+            apa102_recorder_flush();
+        }
+
+        /**
+         * @brief Append a transmitted byte to the current record.
+         *
+         * @param data The byte that was sent via SPI.
+         *
+         * @details
+         * If the record buffer is full, the bytes collected so far are written as a record of their own and recording continues with a new record.
+         */
+        void apa102_recorder_write(unsigned char data)
+        {
+            if (!apa102_recorder_file)
+            {
+                return;
+            }
+            if (apa102_recorder_length >= APA102_RECORDER_BUFFER_SIZE)
+            {
+                apa102_recorder_flush();
+            }
+            apa102_recorder_buffer[apa102_recorder_length++] = data;
+        }
+
+    #else
+
+        static unsigned char apa102_recorder_buffer[APA102_RECORDER_BUFFER_SIZE];
+        static unsigned int apa102_recorder_head;
+        static unsigned char apa102_recorder_wrapped;
+
+        /**
+         * @brief Dump the content of the ring buffer.
+         *
+         * @param sink Function that is called for every byte, starting with the oldest recorded byte.
+         *
+         * @details
+         * The sink can forward the bytes to any interface (e.g. UART). The dump is a raw byte stream without timestamps and can be decoded with `apa102_decode -r`.
+         */
+        void apa102_recorder_dump(void (*sink)(unsigned char data))
+        {
+            unsigned int index = apa102_recorder_wrapped ? apa102_recorder_head : 0;
+            unsigned int count = apa102_recorder_wrapped ? APA102_RECORDER_BUFFER_SIZE : apa102_recorder_head;
+
+            while (count--)
+            {
+                sink(apa102_recorder_buffer[index++]);
+
+                if (index >= APA102_RECORDER_BUFFER_SIZE)
+                {
+                    index = 0;
+                }
+            }
+        }
+
+        /**
+         * @brief Discard all recorded bytes.
+         */
+        void apa102_recorder_clear(void)
+        {
+            apa102_recorder_head = 0;
+            apa102_recorder_wrapped = 0;
+        }
+
+        /**
+         * @brief Start a new record (called on every start-of-frame).
+         *
+         * @details
+         * The ring buffer stores the raw byte stream, record boundaries are recovered by the decoder from the start-of-frame markers.
+         */
+        void apa102_recorder_begin(void)
+        {
+        }
+
+        /**
+         * @brief Finish the current record (called after every end-of-frame).
+         */
+        void apa102_recorder_end(void)
+        {
+        }
+
+        /**
+         * @brief Append a transmitted byte to the ring buffer.
+         *
+         * @param data The byte that was sent via SPI.
+         *
+         * @details
+         * If the ring buffer is full, the oldest byte is overwritten.
+         */
+        void apa102_recorder_write(unsigned char data)
+        {
+            apa102_recorder_buffer[apa102_recorder_head++] = data;
+
+            if (apa102_recorder_head >= APA102_RECORDER_BUFFER_SIZE)
+            {
+                apa102_recorder_head = 0;
+                apa102_recorder_wrapped = 1;
+            }
+        }
+
+    #endif
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file apa102_recorder.h
+ * @brief Recorder capturing the SPI byte stream of the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional frame recorder. Every byte the driver sends via `spi_transfer()` is teed into the recorder. On Linux the bytes are written into a timestamped capture file, on microcontrollers they are kept in a RAM ring buffer that can be dumped (e.g. via UART). Captures can be decoded on the host with `tools/decoder`.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_RECORDER_H_
+#define APA102_RECORDER_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_RECORDER_BUFFER_SIZE
+        /**
+         * @def APA102_RECORDER_BUFFER_SIZE
+         * @brief Defines the size of the recorder buffer in bytes.
+         *
+         * @details
+         * On Linux the buffer collects the bytes of a LED data sequence before they are written as a single record into the capture file (default 65536 bytes, larger sequences are split into multiple records). On microcontrollers it is the size of the ring buffer holding the most recent bytes (default 256 bytes).
+         */
+        #ifdef __linux__
+            #define APA102_RECORDER_BUFFER_SIZE 65536UL
+        #else
+            #define APA102_RECORDER_BUFFER_SIZE 256U
+        #endif
+    #endif
+
+    /**
+     * @def APA102_RECORDER_RAM
+     * @brief Static RAM in bytes used by the frame recorder (buffer and state).
+     */
+    #ifdef __linux__
+        #define APA102_RECORDER_RAM (APA102_RECORDER_BUFFER_SIZE + sizeof(void *) + sizeof(unsigned long) + sizeof(unsigned long long))
+    #else
+        #define APA102_RECORDER_RAM (APA102_RECORDER_BUFFER_SIZE + sizeof(unsigned int) + sizeof(unsigned char))
+    #endif
+
+    /**
+     * @def APA102_RECORDER_MAGIC
+     * @brief Identifier at the beginning of a capture file.
+     *
+     * @details
+     * A capture file starts with the 4 bytes `A102`, the version (`APA102_RECORDER_VERSION`), the frame format (`APA102_FRAME_FORMAT`) and two reserved bytes. Each record consists of the start and end timestamp in nanoseconds (64-bit), the number of bytes (32-bit), all little endian, followed by the recorded bytes. Ring buffer dumps contain the raw bytes only.
+     */
+    #define APA102_RECORDER_MAGIC "A102"
+
+    /**
+     * @def APA102_RECORDER_VERSION
+     * @brief Version of the capture file format.
+     */
+    #define APA102_RECORDER_VERSION 1
+
+    /**
+     * @enum APA102_Recorder_Status_t
+     * @brief Enumerates the results of the recorder functions.
+     */
+    enum APA102_Recorder_Status_t
+    {
+        APA102_Recorder_Ok=0,
+        APA102_Recorder_Error
+    };
+    /**
+     * @typedef APA102_Recorder_Status
+     * @brief Alias for enum APA102_Recorder_Status_t representing the result of a recorder function.
+     */
+    typedef enum APA102_Recorder_Status_t APA102_Recorder_Status;
+
+    #ifdef __linux__
+        APA102_Recorder_Status apa102_recorder_open(const char *path);
+        void apa102_recorder_close(void);
+    #else
+        void apa102_recorder_dump(void (*sink)(unsigned char data));
+        void apa102_recorder_clear(void);
+    #endif
+
+    void apa102_recorder_begin(void);
+    void apa102_recorder_end(void);
+    void apa102_recorder_write(unsigned char data);
+
+#endif /* APA102_RECORDER_H_ */
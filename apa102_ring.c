@@ -0,0 +1,112 @@
+/**
+ * @file apa102_ring.c
+ * @brief Implementation of the ring framebuffer with a rotation offset.
+ *
+ * This source file implements the access to the ring framebuffer by strip position, the rotation of the offset and the transmission of the framebuffer as two segments starting at the offset.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_ring.h"
+
+#ifdef APA102_RING_AVAILABLE
+
+    /**
+     * @brief Initialize a ring framebuffer with all LEDs off.
+     *
+     * @param ring Pointer to the ring framebuffer.
+     * @param frames Buffer with `leds * APA102_LED_FRAME_SIZE` bytes for the encoded LED frames.
+     * @param leds Number of LEDs of the strip.
+     */
+    void apa102_ring_init(APA102_Ring *ring, unsigned char *frames, unsigned int leds)
+    {
+        ring->frames = frames;
+        ring->leds = leds;
+        ring->offset = 0;
+
+        for (unsigned int i=0; i < leds; i++)
+        {
+            apa102_ring_set(ring, i, &(GFX_RGBA_Color){APA102_MIN_INTENSITY, 0x00, 0x00, 0x00});
+        }
+    }
+
+    /**
+     * @brief Set the color of a LED of the strip.
+     *
+     * @param ring Pointer to the ring framebuffer.
+     * @param led Position of the LED in the strip (not the index in the buffer).
+     * @param color Pointer to the color and intensity of the LED.
+     *
+     * @details
+     * The color is encoded with `apa102_encode()` into the frame that is currently sent to the LED at position `led`.
+     *
+     * @note The per-LED calibration is applied for the position at the time the LED is set. After a rotation the calibrated frame moves with the pixel.
+     */
+    void apa102_ring_set(APA102_Ring *ring, unsigned int led, const GFX_RGBA_Color *color)
+    {
+        unsigned int index = ring->offset + led;
+
+        if (index >= ring->leds)
+        {
+            index -= ring->leds;
+        }
+        apa102_encode(led, APA102_START_FLAG | (0x3F & color->alpha), color, &ring->frames[index * APA102_LED_FRAME_SIZE]);
+    }
+
+    /**
+     * @brief Scroll the content of the strip.
+     *
+     * @param ring Pointer to the ring framebuffer.
+     * @param steps Number of LEDs the content moves away from the first LED, negative values move it towards the first LED.
+     *
+     * @details
+     * Only the offset is changed. The LEDs that are scrolled in at the end of the strip show the frames that were scrolled out at the other end, so a running light or chase effect needs no further update. New content is written with `apa102_ring_set()`.
+     */
+    void apa102_ring_rotate(APA102_Ring *ring, signed int steps)
+    {
+        if (!ring->leds)
+        {
+            return;
+        }
+
+        signed long offset = ((signed long)ring->offset - steps) % (signed long)ring->leds;
+
+        if (offset < 0)
+        {
+            offset += ring->leds;
+        }
+        ring->offset = (unsigned int)offset;
+    }
+
+    /**
+     * @brief Transmit the ring framebuffer as LED data sequence.
+     *
+     * @param ring Pointer to the ring framebuffer.
+     *
+     * @return Result of `apa102_gather()`.
+     *
+     * @details
+     * The sequence consists of the start frame, the frames from the offset up to the end of the buffer, the frames from the beginning of the buffer up to the offset and the end frame. No frame is copied.
+     */
+    APA102_Gather_Status apa102_ring_show(const APA102_Ring *ring)
+    {
+        const APA102_Gather_Segment segments[4] = {
+            APA102_GATHER_SOF,
+            APA102_GATHER_LEDS(ring->frames, ring->offset, ring->leds - ring->offset),
+            APA102_GATHER_LEDS(ring->frames, 0, ring->offset),
+            APA102_GATHER_EOF
+        };
+
+        return apa102_gather(segments, 4);
+    }
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file apa102_ring.h
+ * @brief Ring framebuffer with a rotation offset for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional ring framebuffer. The framebuffer holds encoded LED frames and a rotation offset that selects the frame sent to the first LED. Scrolling and chase effects only move the offset, the transmission starts at the offset and wraps around with two segments of the scatter-gather transmission. A scroll step so takes constant time regardless of the strip length.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_RING_H_
+#define APA102_RING_H_
+
+    #include "apa102.h"
+    #include "apa102_gather.h"
+
+    /**
+     * @struct APA102_Ring_t
+     * @brief Ring framebuffer of encoded LED frames.
+     *
+     * @details
+     * The `frames` buffer holds `leds` LED frames with `APA102_LED_FRAME_SIZE` bytes each. The first LED of the strip shows the frame at index `offset`, the following LEDs the frames after it (wrapping around at the end of the buffer).
+     */
+    struct APA102_Ring_t
+    {
+        unsigned char *frames;
+        unsigned int leds;
+        unsigned int offset;
+    };
+    /**
+     * @typedef APA102_Ring
+     * @brief Alias for struct APA102_Ring_t representing a ring framebuffer of encoded LED frames.
+     */
+    typedef struct APA102_Ring_t APA102_Ring;
+
+    void apa102_ring_init(APA102_Ring *ring, unsigned char *frames, unsigned int leds);
+    void apa102_ring_set(APA102_Ring *ring, unsigned int led, const GFX_RGBA_Color *color);
+    void apa102_ring_rotate(APA102_Ring *ring, signed int steps);
+    APA102_Gather_Status apa102_ring_show(const APA102_Ring *ring);
+
+#endif /* APA102_RING_H_ */
@@ -0,0 +1,98 @@
+/**
+ * @file apa102_segment.c
+ * @brief Implementation of the virtual segments.
+ *
+ * This source file implements the transmission of a source color buffer through a segment table. Every LED frame is sent with `apa102_led()`, so the LED frames are the same as for a buffer that holds the expanded layout.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_segment.h"
+
+#ifdef APA102_SEGMENT_AVAILABLE
+
+    static void apa102_segment_slice(const GFX_RGBA_Color *colors, unsigned int length, unsigned char group, unsigned char reverse)
+    {
+        for (unsigned int i=0; i < length; i++)
+        {
+            const GFX_RGBA_Color *color = reverse ? &colors[length - 1 - i] : &colors[i];
+
+            for (unsigned char j=0; j < group; j++)
+            {
+                apa102_led(color);
+            }
+        }
+    }
+
+    /**
+     * @brief Calculate the number of LEDs covered by a segment table.
+     *
+     * @param segments Pointer to the segment table.
+     * @param count Number of segments in the table.
+     *
+     * @return Number of LEDs the segment table drives.
+     */
+    unsigned int apa102_segment_leds(const APA102_Segment *segments, unsigned int count)
+    {
+        unsigned int leds = 0;
+
+        for (unsigned int i=0; i < count; i++)
+        {
+            APA102_Segment segment;
+
+            APA102_SEGMENT_READ(&segment, &segments[i]);
+
+            leds += segment.length * (segment.group ? segment.group : 1) * (segment.repeat ? segment.repeat : 1) * ((segment.mode == APA102_Segment_Mirror) ? 2 : 1);
+        }
+        return leds;
+    }
+
+    /**
+     * @brief Transmit a source color buffer through a segment table.
+     *
+     * @param colors Pointer to the source color buffer (unique pixels of the layout).
+     * @param segments Pointer to the segment table.
+     * @param count Number of segments in the table.
+     *
+     * @details
+     * The function sends a complete LED data sequence: the start frame, the LED frames of all segments in the order of the table and the end frame. Every LED frame is sent with `apa102_led()`, so correction and per-LED calibration are applied for the position on the strip.
+     *
+     * @note The segment table should cover `APA102_NUMBER_OF_LEDS` LEDs, so the end frame matches the chain length.
+     */
+    void apa102_segments(const GFX_RGBA_Color *colors, const APA102_Segment *segments, unsigned int count)
+    {
+        APA102_SOF();
+
+        for (unsigned int i=0; i < count; i++)
+        {
+            APA102_Segment segment;
+
+            APA102_SEGMENT_READ(&segment, &segments[i]);
+
+            unsigned char group = segment.group ? segment.group : 1;
+            unsigned char repeat = segment.repeat ? segment.repeat : 1;
+
+            for (unsigned char j=0; j < repeat; j++)
+            {
+                apa102_segment_slice(&colors[segment.first], segment.length, group, segment.mode == APA102_Segment_Reverse);
+
+                if (segment.mode == APA102_Segment_Mirror)
+                {
+                    apa102_segment_slice(&colors[segment.first], segment.length, group, 1);
+                }
+            }
+        }
+
+        APA102_EOF();
+    }
+
+#endif
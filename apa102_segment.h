@@ -0,0 +1,75 @@
+/**
+ * @file apa102_segment.h
+ * @brief Virtual segments mapping a source buffer onto the APA102 LED strip at transmit time.
+ *
+ * This header file defines the interface of the optional virtual segments. A segment table describes how slices of a source color buffer are laid out on the strip: repeated, reversed, mirrored or grouped (one source pixel drives multiple LEDs). The mapping is resolved while the LED frames are sent, so effects only render the unique pixels of a symmetric layout.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_SEGMENT_H_
+#define APA102_SEGMENT_H_
+
+    #include "apa102.h"
+
+    /**
+     * @enum APA102_Segment_Mode_t
+     * @brief Enumerates the directions a source slice is sent in.
+     */
+    enum APA102_Segment_Mode_t
+    {
+        APA102_Segment_Forward=0,   /**< Source pixels in order. */
+        APA102_Segment_Reverse,     /**< Source pixels in reverse order. */
+        APA102_Segment_Mirror       /**< Source pixels in order followed by the reverse order (twice the length). */
+    };
+    /**
+     * @typedef APA102_Segment_Mode
+     * @brief Alias for enum APA102_Segment_Mode_t representing the direction of a source slice.
+     */
+    typedef enum APA102_Segment_Mode_t APA102_Segment_Mode;
+
+    /**
+     * @struct APA102_Segment_t
+     * @brief Descriptor of a virtual segment.
+     *
+     * @details
+     * The segment sends the source pixels `first` up to `first + length - 1` in the direction of `mode`. Every source pixel drives `group` consecutive LEDs and the whole slice is sent `repeat` times. A `group` or `repeat` of `0` is treated as `1`. The table can be placed in flash (see `APA102_SEGMENT_READ`).
+     */
+    struct APA102_Segment_t
+    {
+        unsigned int first;
+        unsigned int length;
+        unsigned char group;
+        unsigned char repeat;
+        unsigned char mode;
+    };
+    /**
+     * @typedef APA102_Segment
+     * @brief Alias for struct APA102_Segment_t representing the descriptor of a virtual segment.
+     */
+    typedef struct APA102_Segment_t APA102_Segment;
+
+    #ifndef APA102_SEGMENT_READ
+        /**
+         * @def APA102_SEGMENT_READ
+         * @brief Reads a descriptor of the segment table into RAM.
+         *
+         * @details
+         * On platforms with memory mapped flash (e.g. avr0) the table can be accessed directly. Redefine this macro (e.g. with `memcpy_P`) if the table is located in a separate address space.
+         */
+        #define APA102_SEGMENT_READ(segment, address) (*(segment) = *(address))
+    #endif
+
+    unsigned int apa102_segment_leds(const APA102_Segment *segments, unsigned int count);
+    void apa102_segments(const GFX_RGBA_Color *colors, const APA102_Segment *segments, unsigned int count);
+
+#endif /* APA102_SEGMENT_H_ */
@@ -0,0 +1,362 @@
+/**
+ * @file apa102_serial.c
+ * @brief Implementation of the Adalight and TPM2 serial receiver.
+ *
+ * This source file implements a byte-wise parser for both protocols. An Adalight frame starts with `Ada`, the number of LEDs minus one (high and low byte) and a checksum (`high ^ low ^ 0x55`) followed by three color bytes per LED. A TPM2 packet starts with `0xC9`, the packet type (`0xDA` data, `0xC0` command, `0xAA` response), the payload size (high and low byte), the payload and the end byte `0x36`. The receiver starts the LED data sequence with the first payload byte and encodes every LED into a single frame on the stack as soon as its blue byte has arrived. After the last payload byte the sequence is marked complete, the missing LEDs and the end frame are sent from the main loop one frame at a time.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_serial.h"
+
+#ifdef APA102_SERIAL_AVAILABLE
+
+    #define APA102_SERIAL_ADALIGHT_CHECKSUM 0x55
+    #define APA102_SERIAL_TPM2_START        0xC9
+    #define APA102_SERIAL_TPM2_DATA         0xDA
+    #define APA102_SERIAL_TPM2_COMMAND      0xC0
+    #define APA102_SERIAL_TPM2_RESPONSE     0xAA
+    #define APA102_SERIAL_TPM2_END          0x36
+
+    enum
+    {
+        APA102_SERIAL_IDLE=0,
+        APA102_SERIAL_ADA_D,
+        APA102_SERIAL_ADA_A,
+        APA102_SERIAL_ADA_HIGH,
+        APA102_SERIAL_ADA_LOW,
+        APA102_SERIAL_ADA_CHECKSUM,
+        APA102_SERIAL_TPM2_TYPE,
+        APA102_SERIAL_TPM2_HIGH,
+        APA102_SERIAL_TPM2_LOW,
+        APA102_SERIAL_TPM2_SKIP,
+        APA102_SERIAL_TPM2_CLOSE,
+        APA102_SERIAL_PAYLOAD
+    };
+
+    static volatile unsigned char apa102_serial_state;
+    static volatile unsigned char apa102_serial_complete;
+    static unsigned char apa102_serial_type;
+    static unsigned char apa102_serial_high;
+    static unsigned char apa102_serial_channel;
+    static unsigned long apa102_serial_remaining;
+    static unsigned int apa102_serial_led;
+    static GFX_RGBA_Color apa102_serial_color;
+    static APA102_Serial_Statistics apa102_serial_counters;
+
+    static void apa102_serial_start(unsigned char data)
+    {
+        if (data == 'A')
+        {
+            apa102_serial_state = APA102_SERIAL_ADA_D;
+        }
+        else if (data == APA102_SERIAL_TPM2_START)
+        {
+            apa102_serial_state = APA102_SERIAL_TPM2_TYPE;
+        }
+        else
+        {
+            apa102_serial_state = APA102_SERIAL_IDLE;
+        }
+    }
+
+    static void apa102_serial_payload(void)
+    {
+        if (!apa102_serial_remaining)
+        {
+            apa102_serial_state = (apa102_serial_type == 'A') ? APA102_SERIAL_IDLE : APA102_SERIAL_TPM2_CLOSE;
+            return;
+        }
+
+        if (apa102_serial_type == APA102_SERIAL_TPM2_COMMAND || apa102_serial_type == APA102_SERIAL_TPM2_RESPONSE)
+        {
+            apa102_serial_state = APA102_SERIAL_TPM2_SKIP;
+            return;
+        }
+
+        // A sequence that was not completed yet is ended without end frame, the start frame of the next one latches it
+        if (apa102_serial_complete)
+        {
+            apa102_serial_complete = 0;
+            apa102_sequence_end();
+        }
+
+        apa102_serial_led = 0;
+        apa102_serial_channel = 0;
+        apa102_serial_state = APA102_SERIAL_PAYLOAD;
+
+        APA102_SOF();
+    }
+
+    static void apa102_serial_pixel(unsigned char data)
+    {
+        unsigned char frame[APA102_LED_FRAME_SIZE];
+
+        switch (apa102_serial_channel)
+        {
+            case 0:
+                apa102_serial_color.red = data;
+                apa102_serial_channel = 1;
+                return;
+            case 1:
+                apa102_serial_color.green = data;
+                apa102_serial_channel = 2;
+                return;
+            default:
+                apa102_serial_color.blue = data;
+                apa102_serial_channel = 0;
+                break;
+        }
+
+        if (apa102_serial_led < APA102_NUMBER_OF_LEDS)
+        {
+            apa102_encode(apa102_serial_led, APA102_START_FLAG | (0x3F & apa102_serial_color.alpha), &apa102_serial_color, frame);
+            apa102_write(frame, APA102_LED_FRAME_SIZE);
+        }
+        apa102_serial_led++;
+    }
+
+    static void apa102_serial_finish(void)
+    {
+        if (apa102_serial_led > APA102_NUMBER_OF_LEDS)
+        {
+            apa102_serial_led = APA102_NUMBER_OF_LEDS;
+        }
+        apa102_serial_complete = 1;
+    }
+
+    /**
+     * @brief Initializes the serial receiver.
+     *
+     * @param intensity Global intensity (`0` up to `31`) of the received colors, both protocols only transmit 8-bit RGB.
+     *
+     * @details
+     * This function resets the parser and the counters. It must be called before the receive interrupt of the USART is enabled.
+     */
+    void apa102_serial_init(unsigned char intensity)
+    {
+        apa102_serial_state = APA102_SERIAL_IDLE;
+        apa102_serial_complete = 0;
+        apa102_serial_color = (GFX_RGBA_Color){ intensity & APA102_MAX_INTENSITY, 0x00, 0x00, 0x00 };
+        apa102_serial_counters = (APA102_Serial_Statistics){ 0 };
+    }
+
+    /**
+     * @brief Processes a received byte.
+     *
+     * @param data Byte received by the USART.
+     *
+     * @details
+     * This function is called from the receive interrupt of the USART (or a polling loop) for every received byte. It advances the protocol parser and sends a LED frame to the strip whenever the three color bytes of a LED are complete. LEDs beyond `APA102_NUMBER_OF_LEDS` are parsed but not sent. After the last payload byte the sequence is only marked complete, the LEDs missing in the frame and the end frame are sent by `apa102_serial_update()`.
+     *
+     * @note At most one LED frame is sent inside this function. At 8 MHz SPI clock a frame takes about 5 microseconds, while a byte at 1 MBaud takes 10 microseconds. The LED strip must not be written from other parts of the application while the receiver is active.
+     */
+    void apa102_serial_receive(unsigned char data)
+    {
+        switch (apa102_serial_state)
+        {
+            case APA102_SERIAL_ADA_D:
+                if (data == 'd')
+                {
+                    apa102_serial_state = APA102_SERIAL_ADA_A;
+                    return;
+                }
+                break;
+            case APA102_SERIAL_ADA_A:
+                if (data == 'a')
+                {
+                    apa102_serial_state = APA102_SERIAL_ADA_HIGH;
+                    return;
+                }
+                break;
+            case APA102_SERIAL_ADA_HIGH:
+                apa102_serial_high = data;
+                apa102_serial_state = APA102_SERIAL_ADA_LOW;
+                return;
+            case APA102_SERIAL_ADA_LOW:
+                apa102_serial_remaining = 3UL * ((((unsigned long)apa102_serial_high << 8) | data) + 1UL);
+                apa102_serial_high ^= data ^ APA102_SERIAL_ADALIGHT_CHECKSUM;
+                apa102_serial_state = APA102_SERIAL_ADA_CHECKSUM;
+                return;
+            case APA102_SERIAL_ADA_CHECKSUM:
+                if (data == apa102_serial_high)
+                {
+                    apa102_serial_type = 'A';
+                    apa102_serial_payload();
+                    return;
+                }
+                apa102_serial_counters.checksum++;
+                break;
+            case APA102_SERIAL_TPM2_TYPE:
+                if (data == APA102_SERIAL_TPM2_DATA || data == APA102_SERIAL_TPM2_COMMAND || data == APA102_SERIAL_TPM2_RESPONSE)
+                {
+                    apa102_serial_type = data;
+                    apa102_serial_state = APA102_SERIAL_TPM2_HIGH;
+                    return;
+                }
+                apa102_serial_counters.framing++;
+                break;
+            case APA102_SERIAL_TPM2_HIGH:
+                apa102_serial_high = data;
+                apa102_serial_state = APA102_SERIAL_TPM2_LOW;
+                return;
+            case APA102_SERIAL_TPM2_LOW:
+                apa102_serial_remaining = ((unsigned long)apa102_serial_high << 8) | data;
+                apa102_serial_payload();
+                return;
+            case APA102_SERIAL_TPM2_SKIP:
+                if (!--apa102_serial_remaining)
+                {
+                    apa102_serial_state = APA102_SERIAL_TPM2_CLOSE;
+                }
+                return;
+            case APA102_SERIAL_TPM2_CLOSE:
+                if (data == APA102_SERIAL_TPM2_END)
+                {
+                    if (apa102_serial_type == APA102_SERIAL_TPM2_DATA)
+                    {
+                        apa102_serial_counters.tpm2++;
+                    }
+                    apa102_serial_state = APA102_SERIAL_IDLE;
+                    return;
+                }
+                apa102_serial_counters.framing++;
+                break;
+            case APA102_SERIAL_PAYLOAD:
+                apa102_serial_pixel(data);
+
+                if (!--apa102_serial_remaining)
+                {
+                    apa102_serial_finish();
+
+                    if (apa102_serial_type == 'A')
+                    {
+                        apa102_serial_counters.adalight++;
+                        apa102_serial_state = APA102_SERIAL_IDLE;
+                    }
+                    else
+                    {
+                        apa102_serial_state = APA102_SERIAL_TPM2_CLOSE;
+                    }
+                }
+                return;
+            default:
+                break;
+        }
+
+        // Idle or broken header: the byte may start the next frame
+        apa102_serial_start(data);
+    }
+
+    /**
+     * @brief Aborts an incomplete frame.
+     *
+     * @details
+     * This function is called by the application when no byte has been received for a while (e.g. 50 milliseconds), so a frame with lost bytes does not shift the colors of the next frame. A started LED data sequence is marked complete, the LEDs that have been received so far keep their new colors and the remaining LEDs are switched off by `apa102_serial_update()`.
+     *
+     * @note Call this function with the receive interrupt of the USART disabled.
+     */
+    void apa102_serial_reset(void)
+    {
+        if (apa102_serial_state == APA102_SERIAL_IDLE)
+        {
+            return;
+        }
+
+        if (apa102_serial_state == APA102_SERIAL_PAYLOAD)
+        {
+            apa102_serial_finish();
+        }
+        apa102_serial_counters.aborted++;
+        apa102_serial_state = APA102_SERIAL_IDLE;
+    }
+
+    /**
+     * @brief Completes the LED data sequence of a received frame.
+     *
+     * @details
+     * This function is called from the main loop (e.g. together with the timeout check of `apa102_serial_reset()`). If a frame was completed or aborted, the LEDs missing in the frame are switched off and the end frame is sent. The end frame alone would latch them as white LEDs behind a short frame. Every LED frame and end frame byte is sent with the receive interrupt disabled, so the interrupt is delayed by at most one LED frame. If the next frame starts in the meantime, the remaining bytes are dropped.
+     *
+     * @note The function is not called from the receive interrupt, a complete end frame can take more than a millisecond on a long strip.
+     */
+    void apa102_serial_update(void)
+    {
+        unsigned char frame[APA102_LED_FRAME_SIZE];
+
+        for (;;)
+        {
+            APA102_SERIAL_ATOMIC_BEGIN();
+
+            if (!apa102_serial_complete)
+            {
+                APA102_SERIAL_ATOMIC_END();
+                return;
+            }
+
+            if (apa102_serial_led < APA102_NUMBER_OF_LEDS)
+            {
+                GFX_RGBA_Color off = { apa102_serial_color.alpha, 0x00, 0x00, 0x00 };
+
+                apa102_encode(apa102_serial_led, APA102_START_FLAG | (0x3F & off.alpha), &off, frame);
+                apa102_write(frame, APA102_LED_FRAME_SIZE);
+            }
+            else
+            {
+                frame[0] = APA102_EOF_VALUE;
+                apa102_write(frame, 1);
+
+                // The end frame bytes are counted behind the last LED
+                if (apa102_serial_led == (APA102_NUMBER_OF_LEDS + APA102_EOF_SIZE - 1))
+                {
+                    apa102_serial_complete = 0;
+                    apa102_sequence_end();
+                }
+            }
+            apa102_serial_led++;
+
+            APA102_SERIAL_ATOMIC_END();
+        }
+    }
+
+    /**
+     * @brief Returns the state of the serial receiver.
+     *
+     * @return `APA102_Serial_Idle` between frames, `APA102_Serial_Header` while a header is parsed and `APA102_Serial_Data` while LED data or a TPM2 command is received.
+     */
+    APA102_Serial_Status apa102_serial_status(void)
+    {
+        unsigned char state = apa102_serial_state;
+
+        if (state == APA102_SERIAL_IDLE)
+        {
+            return APA102_Serial_Idle;
+        }
+        else if (state == APA102_SERIAL_PAYLOAD || state == APA102_SERIAL_TPM2_SKIP)
+        {
+            return APA102_Serial_Data;
+        }
+        return APA102_Serial_Header;
+    }
+
+    /**
+     * @brief Copies the counters of the serial receiver.
+     *
+     * @param statistics Pointer to the structure that receives the counters.
+     *
+     * @note Call this function with the receive interrupt of the USART disabled, the counters are not read atomically.
+     */
+    void apa102_serial_statistics(APA102_Serial_Statistics *statistics)
+    {
+        *statistics = apa102_serial_counters;
+    }
+
+#endif
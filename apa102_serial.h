@@ -0,0 +1,113 @@
+/**
+ * @file apa102_serial.h
+ * @brief Adalight and TPM2 serial receiver for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional serial receiver. Ambilight software on a PC sends LED colors over a UART with the Adalight or the TPM2 protocol. Every received byte is passed to `apa102_serial_receive()` (usually from the USART receive interrupt), which parses the protocol and sends every LED frame as soon as its three color bytes have arrived. No frame buffer is needed and a LED is updated less than one LED time after its last byte. The LEDs missing in a frame and the end frame are sent by `apa102_serial_update()` from the main loop.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_SERIAL_H_
+#define APA102_SERIAL_H_
+
+    #include "apa102.h"
+
+    #ifndef APA102_SERIAL_ATOMIC_BEGIN
+        /**
+         * @def APA102_SERIAL_ATOMIC_BEGIN
+         * @brief Starts a section that cannot be interrupted by the receive interrupt.
+         *
+         * @details
+         * On AVR the global interrupt flag is saved and cleared. Define this macro together with `APA102_SERIAL_ATOMIC_END` for other platforms if `apa102_serial_receive()` is called from an interrupt.
+         */
+        #if defined(__AVR__)
+            #include <avr/io.h>
+            #include <avr/interrupt.h>
+
+            #define APA102_SERIAL_ATOMIC_BEGIN() unsigned char apa102_serial_sreg = SREG; cli()
+        #else
+            #define APA102_SERIAL_ATOMIC_BEGIN()
+        #endif
+    #endif
+
+    #ifndef APA102_SERIAL_ATOMIC_END
+        /**
+         * @def APA102_SERIAL_ATOMIC_END
+         * @brief Ends a section started with `APA102_SERIAL_ATOMIC_BEGIN`.
+         */
+        #if defined(__AVR__)
+            #define APA102_SERIAL_ATOMIC_END() SREG = apa102_serial_sreg
+        #else
+            #define APA102_SERIAL_ATOMIC_END()
+        #endif
+    #endif
+
+    /**
+     * @def APA102_SERIAL_HELLO
+     * @brief Greeting of an Adalight device.
+     *
+     * @details
+     * Adalight senders wait for this string before they start to send frames. The application sends it over the UART after start-up (and usually every second while no frame is received).
+     */
+    #define APA102_SERIAL_HELLO "Ada\n"
+
+    /**
+     * @enum APA102_Serial_Status_t
+     * @brief Enumerates the states of the serial receiver.
+     */
+    enum APA102_Serial_Status_t
+    {
+        APA102_Serial_Idle=0,
+        APA102_Serial_Header,
+        APA102_Serial_Data
+    };
+    /**
+     * @typedef APA102_Serial_Status
+     * @brief Alias for enum APA102_Serial_Status_t representing the state of the serial receiver.
+     */
+    typedef enum APA102_Serial_Status_t APA102_Serial_Status;
+
+    /**
+     * @struct APA102_Serial_Statistics_t
+     * @brief Counters of the serial receiver.
+     *
+     * @details
+     * `adalight` and `tpm2` count the completed data frames of both protocols. `checksum` counts Adalight headers with a wrong checksum, `framing` TPM2 packets with an unknown type or without end byte and `aborted` frames that were cancelled by `apa102_serial_reset()`.
+     */
+    struct APA102_Serial_Statistics_t
+    {
+        unsigned int adalight;
+        unsigned int tpm2;
+        unsigned int checksum;
+        unsigned int framing;
+        unsigned int aborted;
+    };
+    /**
+     * @typedef APA102_Serial_Statistics
+     * @brief Alias for struct APA102_Serial_Statistics_t representing the counters of the serial receiver.
+     */
+    typedef struct APA102_Serial_Statistics_t APA102_Serial_Statistics;
+
+    /**
+     * @def APA102_SERIAL_RAM
+     * @brief Static RAM in bytes used by the serial receiver (parser state, color of the current LED and counters).
+     */
+    #define APA102_SERIAL_RAM ((5 * sizeof(unsigned char)) + sizeof(unsigned long) + sizeof(unsigned int) + sizeof(GFX_RGBA_Color) + sizeof(APA102_Serial_Statistics))
+
+    void apa102_serial_init(unsigned char intensity);
+    void apa102_serial_receive(unsigned char data);
+    void apa102_serial_reset(void);
+    void apa102_serial_update(void);
+    APA102_Serial_Status apa102_serial_status(void);
+    void apa102_serial_statistics(APA102_Serial_Statistics *statistics);
+
+#endif /* APA102_SERIAL_H_ */
@@ -0,0 +1,258 @@
+/**
+ * @file apa102_text.c
+ * @brief Implementation of the bitmap font text renderer.
+ *
+ * This source file implements the rendering of strings into glyph columns, the scrolling by the start column and the transmission through the matrix mapping. The matrix is walked in the order of the strip like `apa102_matrix_show()`, every LED only needs a column step and a bit test.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_text.h"
+
+#ifdef APA102_TEXT_AVAILABLE
+
+    /* 5x7 font of the printable ASCII characters, one byte per column with the top row in bit 0 */
+    static const unsigned char apa102_text_glyphs_5x7[] = {
+            0x00, 0x00, 0x00, 0x00, 0x00,   /* space */
+            0x00, 0x00, 0x5F, 0x00, 0x00,   /* ! */
+            0x00, 0x07, 0x00, 0x07, 0x00,   /* " */
+            0x14, 0x7F, 0x14, 0x7F, 0x14,   /* # */
+            0x24, 0x2A, 0x7F, 0x2A, 0x12,   /* $ */
+            0x23, 0x13, 0x08, 0x64, 0x62,   /* % */
+            0x36, 0x49, 0x55, 0x22, 0x50,   /* & */
+            0x00, 0x05, 0x03, 0x00, 0x00,   /* ' */
+            0x00, 0x1C, 0x22, 0x41, 0x00,   /* ( */
+            0x00, 0x41, 0x22, 0x1C, 0x00,   /* ) */
+            0x08, 0x2A, 0x1C, 0x2A, 0x08,   /* * */
+            0x08, 0x08, 0x3E, 0x08, 0x08,   /* + */
+            0x00, 0x50, 0x30, 0x00, 0x00,   /* , */
+            0x08, 0x08, 0x08, 0x08, 0x08,   /* - */
+            0x00, 0x60, 0x60, 0x00, 0x00,   /* . */
+            0x20, 0x10, 0x08, 0x04, 0x02,   /* / */
+            0x3E, 0x51, 0x49, 0x45, 0x3E,   /* 0 */
+            0x00, 0x42, 0x7F, 0x40, 0x00,   /* 1 */
+            0x42, 0x61, 0x51, 0x49, 0x46,   /* 2 */
+            0x21, 0x41, 0x45, 0x4B, 0x31,   /* 3 */
+            0x18, 0x14, 0x12, 0x7F, 0x10,   /* 4 */
+            0x27, 0x45, 0x45, 0x45, 0x39,   /* 5 */
+            0x3C, 0x4A, 0x49, 0x49, 0x30,   /* 6 */
+            0x01, 0x71, 0x09, 0x05, 0x03,   /* 7 */
+            0x36, 0x49, 0x49, 0x49, 0x36,   /* 8 */
+            0x06, 0x49, 0x49, 0x29, 0x1E,   /* 9 */
+            0x00, 0x36, 0x36, 0x00, 0x00,   /* : */
+            0x00, 0x56, 0x36, 0x00, 0x00,   /* ; */
+            0x08, 0x14, 0x22, 0x41, 0x00,   /* < */
+            0x14, 0x14, 0x14, 0x14, 0x14,   /* = */
+            0x00, 0x41, 0x22, 0x14, 0x08,   /* > */
+            0x02, 0x01, 0x51, 0x09, 0x06,   /* ? */
+            0x32, 0x49, 0x79, 0x41, 0x3E,   /* @ */
+            0x7E, 0x11, 0x11, 0x11, 0x7E,   /* A */
+            0x7F, 0x49, 0x49, 0x49, 0x36,   /* B */
+            0x3E, 0x41, 0x41, 0x41, 0x22,   /* C */
+            0x7F, 0x41, 0x41, 0x22, 0x1C,   /* D */
+            0x7F, 0x49, 0x49, 0x49, 0x41,   /* E */
+            0x7F, 0x09, 0x09, 0x01, 0x01,   /* F */
+            0x3E, 0x41, 0x41, 0x51, 0x32,   /* G */
+            0x7F, 0x08, 0x08, 0x08, 0x7F,   /* H */
+            0x00, 0x41, 0x7F, 0x41, 0x00,   /* I */
+            0x20, 0x40, 0x41, 0x3F, 0x01,   /* J */
+            0x7F, 0x08, 0x14, 0x22, 0x41,   /* K */
+            0x7F, 0x40, 0x40, 0x40, 0x40,   /* L */
+            0x7F, 0x02, 0x04, 0x02, 0x7F,   /* M */
+            0x7F, 0x04, 0x08, 0x10, 0x7F,   /* N */
+            0x3E, 0x41, 0x41, 0x41, 0x3E,   /* O */
+            0x7F, 0x09, 0x09, 0x09, 0x06,   /* P */
+            0x3E, 0x41, 0x51, 0x21, 0x5E,   /* Q */
+            0x7F, 0x09, 0x19, 0x29, 0x46,   /* R */
+            0x46, 0x49, 0x49, 0x49, 0x31,   /* S */
+            0x01, 0x01, 0x7F, 0x01, 0x01,   /* T */
+            0x3F, 0x40, 0x40, 0x40, 0x3F,   /* U */
+            0x1F, 0x20, 0x40, 0x20, 0x1F,   /* V */
+            0x7F, 0x20, 0x18, 0x20, 0x7F,   /* W */
+            0x63, 0x14, 0x08, 0x14, 0x63,   /* X */
+            0x03, 0x04, 0x78, 0x04, 0x03,   /* Y */
+            0x61, 0x51, 0x49, 0x45, 0x43,   /* Z */
+            0x00, 0x7F, 0x41, 0x41, 0x00,   /* [ */
+            0x02, 0x04, 0x08, 0x10, 0x20,   /* backslash */
+            0x00, 0x41, 0x41, 0x7F, 0x00,   /* ] */
+            0x04, 0x02, 0x01, 0x02, 0x04,   /* ^ */
+            0x40, 0x40, 0x40, 0x40, 0x40,   /* _ */
+            0x00, 0x01, 0x02, 0x04, 0x00,   /* ` */
+            0x20, 0x54, 0x54, 0x54, 0x78,   /* a */
+            0x7F, 0x48, 0x44, 0x44, 0x38,   /* b */
+            0x38, 0x44, 0x44, 0x44, 0x20,   /* c */
+            0x38, 0x44, 0x44, 0x48, 0x7F,   /* d */
+            0x38, 0x54, 0x54, 0x54, 0x18,   /* e */
+            0x08, 0x7E, 0x09, 0x01, 0x02,   /* f */
+            0x08, 0x14, 0x54, 0x54, 0x3C,   /* g */
+            0x7F, 0x08, 0x04, 0x04, 0x78,   /* h */
+            0x00, 0x44, 0x7D, 0x40, 0x00,   /* i */
+            0x20, 0x40, 0x44, 0x3D, 0x00,   /* j */
+            0x00, 0x7F, 0x10, 0x28, 0x44,   /* k */
+            0x00, 0x41, 0x7F, 0x40, 0x00,   /* l */
+            0x7C, 0x04, 0x18, 0x04, 0x78,   /* m */
+            0x7C, 0x08, 0x04, 0x04, 0x78,   /* n */
+            0x38, 0x44, 0x44, 0x44, 0x38,   /* o */
+            0x7C, 0x14, 0x14, 0x14, 0x08,   /* p */
+            0x08, 0x14, 0x14, 0x18, 0x7C,   /* q */
+            0x7C, 0x08, 0x04, 0x04, 0x08,   /* r */
+            0x48, 0x54, 0x54, 0x54, 0x20,   /* s */
+            0x04, 0x3F, 0x44, 0x40, 0x20,   /* t */
+            0x3C, 0x40, 0x40, 0x20, 0x7C,   /* u */
+            0x1C, 0x20, 0x40, 0x20, 0x1C,   /* v */
+            0x3C, 0x40, 0x30, 0x40, 0x3C,   /* w */
+            0x44, 0x28, 0x10, 0x28, 0x44,   /* x */
+            0x0C, 0x50, 0x50, 0x50, 0x3C,   /* y */
+            0x44, 0x64, 0x54, 0x4C, 0x44,   /* z */
+            0x00, 0x08, 0x36, 0x41, 0x00,   /* { */
+            0x00, 0x00, 0x7F, 0x00, 0x00,   /* | */
+            0x00, 0x41, 0x36, 0x08, 0x00,   /* } */
+            0x02, 0x01, 0x02, 0x04, 0x02    /* ~ */
+    };
+
+    /**
+     * @brief 5x7 font of the printable ASCII characters (`' '` up to `'~'`).
+     */
+    const APA102_Text_Font apa102_text_font_5x7 = { apa102_text_glyphs_5x7, 5, 7, ' ', '~' };
+
+    /**
+     * @brief Render a string into the glyph columns of a text.
+     *
+     * @param text Pointer to the text with the column buffer (`columns`, `size`).
+     * @param font Pointer to the bitmap font.
+     * @param string Zero terminated string, characters without glyph are rendered blank.
+     * @param gap Number of blank columns after the string (e.g. the width of the matrix, so the text scrolls in and out).
+     *
+     * @return Number of rendered columns, the string is cut if the buffer is too small.
+     *
+     * @details
+     * Every glyph is followed by one blank column. The offset of the text is reset to the first column.
+     */
+    unsigned int apa102_text_render(APA102_Text *text, const APA102_Text_Font *font, const char *string, unsigned int gap)
+    {
+        unsigned int length = 0;
+
+        for (; *string; string++)
+        {
+            unsigned char character = (unsigned char)*string;
+            const unsigned char *glyph = 0;
+
+            if ((character >= font->first) && (character <= font->last))
+            {
+                glyph = &font->glyphs[(unsigned int)(character - font->first) * font->width];
+            }
+
+            for (unsigned char column=0; (column <= font->width) && (length < text->size); column++)
+            {
+                text->columns[length++] = (glyph && (column < font->width)) ? APA102_TEXT_READ(&glyph[column]) : 0x00;
+            }
+        }
+
+        for (; gap && (length < text->size); gap--)
+        {
+            text->columns[length++] = 0x00;
+        }
+
+        text->length = length;
+        text->offset = 0;
+
+        return length;
+    }
+
+    /**
+     * @brief Scroll a text by moving its start column.
+     *
+     * @param text Pointer to the text.
+     * @param steps Number of columns the text moves to the left (negative values move it to the right).
+     *
+     * @details
+     * The columns are not rendered again, the text wraps around after the last column.
+     */
+    void apa102_text_scroll(APA102_Text *text, signed int steps)
+    {
+        if (!text->length)
+        {
+            return;
+        }
+
+        signed long offset = ((signed long)text->offset + steps) % (signed long)text->length;
+
+        if (offset < 0)
+        {
+            offset += text->length;
+        }
+        text->offset = (unsigned int)offset;
+    }
+
+    /**
+     * @brief Transmit the visible window of a text to the LED matrix.
+     *
+     * @param text Pointer to the text.
+     * @param matrix Pointer to the size and wiring of the matrix.
+     *
+     * @details
+     * The function sends a complete LED data sequence. Rows below the font and all pixels without text are sent with the background color. The LEDs are walked in the order of the strip, so no framebuffer is needed.
+     */
+    void apa102_text_show(const APA102_Text *text, const APA102_Matrix *matrix)
+    {
+        unsigned char columns = (matrix->layout & APA102_Matrix_Columns) ? 1 : 0;
+        unsigned char flip = (matrix->layout & (columns ? APA102_Matrix_FlipY : APA102_Matrix_FlipX)) ? 1 : 0;
+        unsigned int lines = columns ? matrix->width : matrix->height;
+        unsigned int length = columns ? matrix->height : matrix->width;
+
+        APA102_SOF();
+
+        for (unsigned int major=0; major < lines; major++)
+        {
+            unsigned int x, y;
+            unsigned char backwards = flip ^ (((matrix->layout & APA102_Matrix_Serpentine) && (major & 0x01)) ? 1 : 0);
+
+            apa102_matrix_position(matrix, major * length, &x, &y);
+
+            unsigned int column = text->length ? ((text->offset + x) % text->length) : 0;
+
+            if (columns)
+            {
+                /* a line of the strip is one column of the text */
+                unsigned char bits = text->length ? text->columns[column] : 0x00;
+
+                for (unsigned int minor=0; minor < length; minor++)
+                {
+                    apa102_led(((y < 8) && ((bits >> y) & 0x01)) ? &text->foreground : &text->background);
+                    y = backwards ? (y - 1) : (y + 1);
+                }
+            }
+            else
+            {
+                /* a line of the strip is one row of the text */
+                unsigned char mask = (text->length && (y < 8)) ? (unsigned char)(1 << y) : 0x00;
+
+                for (unsigned int minor=0; minor < length; minor++)
+                {
+                    apa102_led((mask && (text->columns[column] & mask)) ? &text->foreground : &text->background);
+
+                    if (backwards)
+                    {
+                        column = column ? (column - 1) : (text->length - 1);
+                    }
+                    else if (++column >= text->length)
+                    {
+                        column = 0;
+                    }
+                }
+            }
+        }
+
+        APA102_EOF();
+    }
+
+#endif
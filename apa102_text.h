@@ -0,0 +1,85 @@
+/**
+ * @file apa102_text.h
+ * @brief Bitmap font text renderer for LED matrices of the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional text renderer. A string is rendered once with a bitmap font (stored in flash) into a buffer of glyph columns, one byte per column with the top row in bit 0. Scrolling only moves the start column of the buffer, the visible window is sent through the matrix mapping straight into the LED data sequence without a framebuffer.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_TEXT_H_
+#define APA102_TEXT_H_
+
+    #include "apa102.h"
+    #include "apa102_matrix.h"
+
+    #ifndef APA102_TEXT_READ
+        /**
+         * @def APA102_TEXT_READ
+         * @brief Reads a byte of a font.
+         *
+         * @details
+         * On platforms with memory mapped flash (e.g. avr0) the font can be accessed directly. Redefine this macro (e.g. with `pgm_read_byte`) if the font is located in a separate address space.
+         */
+        #define APA102_TEXT_READ(address) (*(address))
+    #endif
+
+    /**
+     * @struct APA102_Text_Font_t
+     * @brief Bitmap font with a fixed glyph width.
+     *
+     * @details
+     * Every glyph consists of `width` column bytes (top row in bit 0, at most 8 rows). The glyphs of the characters `first` up to `last` are stored one after another in `glyphs`.
+     */
+    struct APA102_Text_Font_t
+    {
+        const unsigned char *glyphs;
+        unsigned char width;
+        unsigned char height;
+        unsigned char first;
+        unsigned char last;
+    };
+    /**
+     * @typedef APA102_Text_Font
+     * @brief Alias for struct APA102_Text_Font_t representing a bitmap font.
+     */
+    typedef struct APA102_Text_Font_t APA102_Text_Font;
+
+    /**
+     * @struct APA102_Text_t
+     * @brief Rendered text scrolling over a LED matrix.
+     *
+     * @details
+     * The buffer `columns` with `size` bytes is provided by the application and holds `length` rendered glyph columns. The matrix column `x` shows the buffer column `(offset + x) % length`, pixels that are set are sent with `foreground`, all others with `background`.
+     */
+    struct APA102_Text_t
+    {
+        unsigned char *columns;
+        unsigned int size;
+        unsigned int length;
+        unsigned int offset;
+        GFX_RGBA_Color foreground;
+        GFX_RGBA_Color background;
+    };
+    /**
+     * @typedef APA102_Text
+     * @brief Alias for struct APA102_Text_t representing rendered text scrolling over a LED matrix.
+     */
+    typedef struct APA102_Text_t APA102_Text;
+
+    extern const APA102_Text_Font apa102_text_font_5x7;
+
+    unsigned int apa102_text_render(APA102_Text *text, const APA102_Text_Font *font, const char *string, unsigned int gap);
+    void apa102_text_scroll(APA102_Text *text, signed int steps);
+    void apa102_text_show(const APA102_Text *text, const APA102_Matrix *matrix);
+
+#endif /* APA102_TEXT_H_ */
@@ -0,0 +1,140 @@
+/**
+ * @file apa102_tx.c
+ * @brief Implementation of the cooperative transmission of LED data sequences.
+ *
+ * This source file implements a resumable state machine that sends the start frame, the LED frames of a buffer and the end frame of a LED data sequence byte by byte. The state is kept between the calls of `apa102_tx_poll()`, so a refresh can be spread over many iterations of the superloop.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_tx.h"
+
+#ifdef APA102_TX_AVAILABLE
+
+    #define APA102_TX_PHASE_IDLE 0
+    #define APA102_TX_PHASE_SOF  1
+    #define APA102_TX_PHASE_LED  2
+    #define APA102_TX_PHASE_EOF  3
+
+    static const GFX_RGBA_Color *apa102_tx_colors;
+    static unsigned int apa102_tx_leds;
+    static unsigned int apa102_tx_led;
+    static unsigned int apa102_tx_offset;
+    static unsigned char apa102_tx_phase;
+    static unsigned char apa102_tx_frame[APA102_LED_FRAME_SIZE];
+
+    /**
+     * @brief Start the cooperative transmission of a LED buffer.
+     *
+     * @param colors Pointer to the colors of the LEDs, the buffer has to stay valid until the transmission is finished.
+     * @param leds Number of LEDs in the buffer.
+     *
+     * @return `APA102_Tx_Busy` if the transmission was started, `APA102_Tx_Idle` if it could not be started.
+     *
+     * @details
+     * Nothing is sent by this function, the bytes are transmitted by the following calls of `apa102_tx_poll()`. A transmission that is still running is not restarted, the function returns `APA102_Tx_Idle` in this case.
+     */
+    APA102_Tx_Status apa102_tx_begin(const GFX_RGBA_Color *colors, unsigned int leds)
+    {
+        if (apa102_tx_phase != APA102_TX_PHASE_IDLE)
+        {
+            return APA102_Tx_Idle;
+        }
+
+        apa102_tx_colors = colors;
+        apa102_tx_leds = leds;
+        apa102_tx_led = 0;
+        apa102_tx_offset = 0;
+        apa102_tx_phase = APA102_TX_PHASE_SOF;
+
+        return APA102_Tx_Busy;
+    }
+
+    /**
+     * @brief Continue the cooperative transmission.
+     *
+     * @param budget Maximum number of bytes that are sent by this call (see `APA102_TX_BYTES` for a time budget).
+     *
+     * @return `APA102_Tx_Busy` while bytes of the LED data sequence are left, `APA102_Tx_Idle` when the transmission is finished.
+     *
+     * @details
+     * The LED data sequence is framed like a blocking refresh: `apa102_sequence_begin()` and `APA102_FRAME_SIZE` start frame bytes, one LED frame per color encoded with `apa102_encode()` and the mode byte of `apa102_led()`, and `APA102_EOF_SIZE` end frame bytes followed by `apa102_sequence_end()`. A LED frame is encoded when its first byte is sent. With a shared bus the bus stays locked from the first to the last call.
+     */
+    APA102_Tx_Status apa102_tx_poll(unsigned int budget)
+    {
+        while (budget && (apa102_tx_phase != APA102_TX_PHASE_IDLE))
+        {
+            unsigned char data;
+
+            if (apa102_tx_phase == APA102_TX_PHASE_SOF)
+            {
+                if (!apa102_tx_offset)
+                {
+                    apa102_sequence_begin();
+                }
+                data = APA102_Transmission_SOF;
+
+                if (++apa102_tx_offset >= APA102_FRAME_SIZE)
+                {
+                    apa102_tx_offset = 0;
+                    apa102_tx_phase = apa102_tx_leds ? APA102_TX_PHASE_LED : APA102_TX_PHASE_EOF;
+                }
+            }
+            else if (apa102_tx_phase == APA102_TX_PHASE_LED)
+            {
+                if (!apa102_tx_offset)
+                {
+                    const GFX_RGBA_Color *color = &apa102_tx_colors[apa102_tx_led];
+
+                    apa102_encode(apa102_tx_led, APA102_START_FLAG | (0x3F & color->alpha), color, apa102_tx_frame);
+                }
+                data = apa102_tx_frame[apa102_tx_offset];
+
+                if (++apa102_tx_offset >= APA102_LED_FRAME_SIZE)
+                {
+                    apa102_tx_offset = 0;
+
+                    if (++apa102_tx_led >= apa102_tx_leds)
+                    {
+                        apa102_tx_phase = APA102_TX_PHASE_EOF;
+                    }
+                }
+            }
+            else
+            {
+                data = APA102_Transmission_EOF;
+                apa102_tx_offset++;
+            }
+
+            apa102_write(&data, 1);
+            budget--;
+
+            if ((apa102_tx_phase == APA102_TX_PHASE_EOF) && (apa102_tx_offset >= APA102_EOF_SIZE))
+            {
+                apa102_tx_phase = APA102_TX_PHASE_IDLE;
+                apa102_sequence_end();
+            }
+        }
+        return apa102_tx_status();
+    }
+
+    /**
+     * @brief Read the state of the cooperative transmission.
+     *
+     * @return `APA102_Tx_Busy` while a transmission is running, `APA102_Tx_Idle` otherwise.
+     */
+    APA102_Tx_Status apa102_tx_status(void)
+    {
+        return (apa102_tx_phase == APA102_TX_PHASE_IDLE) ? APA102_Tx_Idle : APA102_Tx_Busy;
+    }
+
+#endif
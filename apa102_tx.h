@@ -0,0 +1,61 @@
+/**
+ * @file apa102_tx.h
+ * @brief Cooperative transmission of LED data sequences for the APA102 LED driver.
+ *
+ * This header file defines the interface of the optional cooperative transmission. A refresh of a LED buffer is started with `apa102_tx_begin()` and sent in small steps by calling `apa102_tx_poll()` from the superloop. Every call sends at most the given number of bytes and returns, so other tasks keep running while a long strip is refreshed. The bytes on the wire are the same as with `APA102_SOF()`, `apa102_led()` and `APA102_EOF()`.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_TX_H_
+#define APA102_TX_H_
+
+    #include "apa102.h"
+
+    /**
+     * @def APA102_TX_BYTES
+     * @brief Converts a time budget into a byte budget for `apa102_tx_poll()`.
+     *
+     * @param time Time budget in microseconds.
+     * @param clock SPI clock frequency in Hz.
+     *
+     * @details
+     * The result is the number of bytes that can be shifted out within the given time at the given SPI clock. The product of `time` and `clock / 8` has to fit into 32 bits.
+     */
+    #define APA102_TX_BYTES(time, clock) ((unsigned int)(((unsigned long)(time) * ((unsigned long)(clock) / 8UL)) / 1000000UL))
+
+    /**
+     * @def APA102_TX_RAM
+     * @brief Static RAM in bytes used by the cooperative transmission (state and encoded LED frame).
+     */
+    #define APA102_TX_RAM (sizeof(void *) + (3 * sizeof(unsigned int)) + sizeof(unsigned char) + APA102_LED_FRAME_SIZE)
+
+    /**
+     * @enum APA102_Tx_Status_t
+     * @brief Enumerates the states of the cooperative transmission.
+     */
+    enum APA102_Tx_Status_t
+    {
+        APA102_Tx_Idle=0,
+        APA102_Tx_Busy
+    };
+    /**
+     * @typedef APA102_Tx_Status
+     * @brief Alias for enum APA102_Tx_Status_t representing the state of the cooperative transmission.
+     */
+    typedef enum APA102_Tx_Status_t APA102_Tx_Status;
+
+    APA102_Tx_Status apa102_tx_begin(const GFX_RGBA_Color *colors, unsigned int leds);
+    APA102_Tx_Status apa102_tx_poll(unsigned int budget);
+    APA102_Tx_Status apa102_tx_status(void);
+
+#endif /* APA102_TX_H_ */
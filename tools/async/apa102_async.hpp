@@ -0,0 +1,483 @@
+/**
+ * @file apa102_async.hpp
+ * @brief C++20 coroutine transmission of APA102 LED strips for Linux services.
+ *
+ * This header provides an awaitable `show()` for LED strips driven by a Linux service. The LED frames are encoded on the event loop thread with the C driver (`apa102_encode()`), the blocking `spidev` transfers run on a small pool of worker threads. A finished transfer wakes the single-threaded event loop through an `eventfd`, which resumes the waiting coroutine. Many strips can so be refreshed concurrently from one thread without a blocked thread per bus.
+ *
+ * @code
+ * apa102::Loop loop;
+ * apa102::Backend backend(loop, 2);
+ * apa102::Bus bus(backend);
+ * apa102::Strip strip(bus, 144);
+ *
+ * bus.open("/dev/spidev0.0", 8000000);
+ *
+ * apa102::Task animate(apa102::Strip &strip)
+ * {
+ *     for (;;)
+ *     {
+ *         strip[0] = GFX_RGBA_Color{ 0x1F, 0xFF, 0x00, 0x00 };
+ *         co_await strip.show();
+ *     }
+ * }
+ *
+ * animate(strip);
+ * loop.run();
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_ASYNC_HPP_
+#define APA102_ASYNC_HPP_
+
+    #include <cerrno>
+    #include <condition_variable>
+    #include <coroutine>
+    #include <cstddef>
+    #include <deque>
+    #include <exception>
+    #include <mutex>
+    #include <system_error>
+    #include <thread>
+    #include <vector>
+
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/ioctl.h>
+    #include <unistd.h>
+    #include <linux/spi/spidev.h>
+
+    extern "C"
+    {
+        #include "../../apa102.h"
+    }
+
+    #ifndef APA102_ASYNC_CHUNK
+        /**
+         * @def APA102_ASYNC_CHUNK
+         * @brief Maximum number of bytes written to the device at once (default buffer size of `spidev`).
+         */
+        #define APA102_ASYNC_CHUNK 4096
+    #endif
+
+    namespace apa102
+    {
+        class Bus;
+
+        /**
+         * @struct Job
+         * @brief Transfer of an encoded LED data sequence, owned by the strip that started it.
+         */
+        struct Job
+        {
+            Bus *bus = nullptr;
+            const unsigned char *data = nullptr;
+            std::size_t length = 0;
+            int status = 0;
+            std::coroutine_handle<> handle;
+        };
+
+        /**
+         * @class Loop
+         * @brief Single-threaded event loop resuming the coroutines of finished transfers.
+         *
+         * @details
+         * The loop can run on its own with `run()` or be integrated into an existing event loop: add `fd()` to the `poll`/`epoll` set and call `dispatch()` when it becomes readable.
+         */
+        class Loop
+        {
+            public:
+                /**
+                 * @brief Create the event file descriptor of the loop.
+                 *
+                 * @throws std::system_error with the `errno` of `eventfd()` if the descriptor cannot be created.
+                 */
+                Loop() : event(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+                {
+                    if (event < 0)
+                    {
+                        throw std::system_error(errno, std::generic_category(), "eventfd");
+                    }
+                }
+                ~Loop() { close(event); }
+
+                Loop(const Loop &) = delete;
+                Loop &operator=(const Loop &) = delete;
+
+                /**
+                 * @brief File descriptor that becomes readable when transfers are finished.
+                 */
+                int fd() const { return event; }
+
+                /**
+                 * @brief Number of transfers that are submitted and not yet resumed.
+                 */
+                std::size_t pending() const { return outstanding; }
+
+                /**
+                 * @brief Resume the coroutines of all finished transfers.
+                 *
+                 * @return Number of resumed coroutines.
+                 */
+                std::size_t dispatch()
+                {
+                    std::deque<Job *> finished;
+                    eventfd_t value;
+
+                    eventfd_read(event, &value);
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        finished.swap(done);
+                    }
+                    for (Job *job : finished)
+                    {
+                        outstanding--;
+                        job->handle.resume();
+                    }
+                    return finished.size();
+                }
+
+                /**
+                 * @brief Run the loop until no transfer is pending.
+                 */
+                void run()
+                {
+                    struct pollfd descriptor = { event, POLLIN, 0 };
+
+                    while (outstanding)
+                    {
+                        if (poll(&descriptor, 1, -1) > 0)
+                        {
+                            dispatch();
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Count a submitted transfer (called on the loop thread).
+                 */
+                void submitted() { outstanding++; }
+
+                /**
+                 * @brief Queue a finished transfer and wake the loop (called on a worker thread).
+                 */
+                void complete(Job *job)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done.push_back(job);
+                    }
+                    eventfd_write(event, 1);
+                }
+
+            private:
+                int event;
+                std::size_t outstanding = 0;
+                std::mutex mutex;
+                std::deque<Job *> done;
+        };
+
+        /**
+         * @class Backend
+         * @brief Pool of worker threads executing the blocking device transfers.
+         */
+        class Backend
+        {
+            public:
+                Backend(Loop &loop, unsigned int threads = 1) : loop(loop)
+                {
+                    for (unsigned int i=0; i < (threads ? threads : 1); i++)
+                    {
+                        workers.emplace_back([this] { work(); });
+                    }
+                }
+
+                ~Backend()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopped = true;
+                    }
+                    wakeup.notify_all();
+
+                    for (std::thread &worker : workers)
+                    {
+                        worker.join();
+                    }
+                }
+
+                Backend(const Backend &) = delete;
+                Backend &operator=(const Backend &) = delete;
+
+                /**
+                 * @brief Hand a transfer to the worker threads.
+                 */
+                void submit(Job *job)
+                {
+                    loop.submitted();
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        queue.push_back(job);
+                    }
+                    wakeup.notify_one();
+                }
+
+            private:
+                void work();
+
+                Loop &loop;
+                std::vector<std::thread> workers;
+                std::mutex mutex;
+                std::condition_variable wakeup;
+                std::deque<Job *> queue;
+                bool stopped = false;
+        };
+
+        /**
+         * @class Bus
+         * @brief SPI device (or any writable file) the LED strip is connected to.
+         *
+         * @details
+         * Transfers on the same bus are serialized, so strips sharing a bus never interleave their bytes. `delay` emulates the bus timing (in nanoseconds per byte) for sinks without a clock, e.g. `/dev/null` in benchmarks.
+         */
+        class Bus
+        {
+            public:
+                explicit Bus(Backend &backend) : backend(backend) { }
+                ~Bus() { if (descriptor >= 0) { close(descriptor); } }
+
+                Bus(const Bus &) = delete;
+                Bus &operator=(const Bus &) = delete;
+
+                /**
+                 * @brief Open the device of the bus.
+                 *
+                 * @param path Path of the `spidev` device or file.
+                 * @param clock SPI clock frequency in Hz, only applied to `spidev` devices.
+                 *
+                 * @return `0` on success, a negative `errno` value otherwise.
+                 *
+                 * @details
+                 * A device that was opened before is closed. The device is replaced under the lock of the bus, so a running transfer finishes on the previous device.
+                 */
+                int open(const char *path, unsigned int clock = 0)
+                {
+                    unsigned char mode = SPI_MODE_0;
+                    unsigned char bits = 8;
+                    int opened = ::open(path, O_WRONLY | O_CLOEXEC);
+
+                    if (opened < 0)
+                    {
+                        return -errno;
+                    }
+                    if (ioctl(opened, SPI_IOC_WR_MODE, &mode) == 0)
+                    {
+                        ioctl(opened, SPI_IOC_WR_BITS_PER_WORD, &bits);
+
+                        if (clock)
+                        {
+                            ioctl(opened, SPI_IOC_WR_MAX_SPEED_HZ, &clock);
+                        }
+                    }
+
+                    int previous;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        previous = descriptor;
+                        descriptor = opened;
+                    }
+
+                    if (previous >= 0)
+                    {
+                        close(previous);
+                    }
+                    return 0;
+                }
+
+                /**
+                 * @brief Emulate the bus timing with the given time per byte in nanoseconds.
+                 */
+                void emulate(unsigned long delay) { nanoseconds = delay; }
+
+                Backend &backend;
+
+            private:
+                friend class Backend;
+
+                int transfer(const unsigned char *data, std::size_t length)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    while (length)
+                    {
+                        ssize_t written = write(descriptor, data, (length > APA102_ASYNC_CHUNK) ? APA102_ASYNC_CHUNK : length);
+
+                        if (written < 0)
+                        {
+                            if (errno == EINTR)
+                            {
+                                continue;
+                            }
+                            return -errno;
+                        }
+                        if (nanoseconds)
+                        {
+                            unsigned long long delay = (unsigned long long)written * nanoseconds;
+                            struct timespec time = { (time_t)(delay / 1000000000ULL), (long)(delay % 1000000000ULL) };
+
+                            nanosleep(&time, nullptr);
+                        }
+                        data += written;
+                        length -= (std::size_t)written;
+                    }
+                    return 0;
+                }
+
+                int descriptor = -1;
+                unsigned long nanoseconds = 0;
+                std::mutex mutex;
+        };
+
+        inline void Backend::work()
+        {
+            for (;;)
+            {
+                Job *job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+
+                    wakeup.wait(lock, [this] { return stopped || !queue.empty(); });
+
+                    if (queue.empty())
+                    {
+                        return;
+                    }
+                    job = queue.front();
+                    queue.pop_front();
+                }
+                job->status = job->bus->transfer(job->data, job->length);
+                loop.complete(job);
+            }
+        }
+
+        class Strip;
+
+        /**
+         * @class Show
+         * @brief Awaitable transmission of a strip, resumes with `0` or a negative `errno` value.
+         */
+        class Show
+        {
+            public:
+                explicit Show(Strip &strip) : strip(strip) { }
+
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle);
+                int await_resume() const noexcept;
+
+            private:
+                Strip &strip;
+        };
+
+        /**
+         * @class Strip
+         * @brief LED buffer of a strip together with its encoded LED data sequence.
+         */
+        class Strip
+        {
+            public:
+                Strip(Bus &bus, std::size_t leds) : bus(bus), colors(leds, GFX_RGBA_Color{ 0, 0, 0, 0 }) { }
+
+                GFX_RGBA_Color &operator[](std::size_t led) { return colors[led]; }
+                std::size_t size() const { return colors.size(); }
+
+                /**
+                 * @brief Encode the LED buffer into the LED data sequence.
+                 *
+                 * @details
+                 * The sequence has the layout of a blocking refresh: `APA102_FRAME_SIZE` start frame bytes, one LED frame per LED encoded with `apa102_encode()` and the mode byte of `apa102_led()`, and the end frame sized with `APA102_EOF_LENGTH()` for the length of this strip.
+                 */
+                void encode()
+                {
+                    std::size_t eof = APA102_EOF_LENGTH(colors.size());
+
+                    data.resize(APA102_FRAME_SIZE + (colors.size() * APA102_LED_FRAME_SIZE) + eof);
+
+                    unsigned char *frame = data.data();
+
+                    for (std::size_t i=0; i < APA102_FRAME_SIZE; i++)
+                    {
+                        *frame++ = APA102_SOF_VALUE;
+                    }
+                    for (std::size_t i=0; i < colors.size(); i++)
+                    {
+                        apa102_encode((unsigned int)i, APA102_START_FLAG | (0x3F & colors[i].alpha), &colors[i], frame);
+                        frame += APA102_LED_FRAME_SIZE;
+                    }
+                    for (std::size_t i=0; i < eof; i++)
+                    {
+                        *frame++ = APA102_EOF_VALUE;
+                    }
+                }
+
+                /**
+                 * @brief Encode and transmit the LED buffer, `co_await` resumes when the transfer is finished.
+                 */
+                Show show() { return Show(*this); }
+
+            private:
+                friend class Show;
+
+                Bus &bus;
+                std::vector<GFX_RGBA_Color> colors;
+                std::vector<unsigned char> data;
+                Job job;
+        };
+
+        inline void Show::await_suspend(std::coroutine_handle<> handle)
+        {
+            strip.encode();
+
+            strip.job.bus = &strip.bus;
+            strip.job.data = strip.data.data();
+            strip.job.length = strip.data.size();
+            strip.job.handle = handle;
+
+            strip.bus.backend.submit(&strip.job);
+        }
+
+        inline int Show::await_resume() const noexcept
+        {
+            return strip.job.status;
+        }
+
+        /**
+         * @struct Task
+         * @brief Coroutine type of a detached LED task, started immediately and destroyed when it returns.
+         */
+        struct Task
+        {
+            struct promise_type
+            {
+                Task get_return_object() noexcept { return {}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() noexcept { }
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+        };
+    }
+
+#endif /* APA102_ASYNC_HPP_ */
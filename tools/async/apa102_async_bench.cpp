@@ -0,0 +1,153 @@
+/**
+ * @file apa102_async_bench.cpp
+ * @brief Benchmark of concurrent LED strips driven by one coroutine event loop.
+ *
+ * This host tool starts an increasing number of strips, each refreshed by its own coroutine with `co_await strip.show()`, and measures the CPU time of the event loop thread (encoding, scheduling and resuming). The result is the number of strips one core can keep at the target frame rate. Without a device the strips write to `/dev/null`, `-c` emulates the bus timing of the given SPI clock.
+ *
+ * @code
+ * apa102_async_bench [-n leds] [-f frames] [-F fps] [-t threads] [-c clock] [-s max_strips] [-d device]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+
+#include "apa102_async.hpp"
+
+extern "C" unsigned char spi_transfer(unsigned char data)
+{
+    return data;
+}
+
+static double bench_clock(clockid_t clock)
+{
+    struct timespec now;
+
+    clock_gettime(clock, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static apa102::Task bench_strip(apa102::Strip &strip, unsigned int frames, unsigned int seed, unsigned long &errors)
+{
+    for (unsigned int frame=0; frame < frames; frame++)
+    {
+        for (std::size_t i=0; i < strip.size(); i++)
+        {
+            unsigned char value = (unsigned char)(seed + frame + i);
+
+            strip[i] = GFX_RGBA_Color{ 0x1F, value, (unsigned char)(value << 1), (unsigned char)(value << 2) };
+        }
+
+        if (co_await strip.show())
+        {
+            errors++;
+        }
+    }
+}
+
+static void bench_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-n leds] [-f frames] [-F fps] [-t threads] [-c clock] [-s max_strips] [-d device]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int leds = 1000;
+    unsigned int frames = 200;
+    double fps = 60.0;
+    unsigned int threads = 4;
+    unsigned long clock = 0;
+    unsigned int strips = 64;
+    const char *device = "/dev/null";
+    int option;
+
+    while ((option = getopt(argc, argv, "n:f:F:t:c:s:d:")) != -1)
+    {
+        switch (option)
+        {
+            case 'n': leds = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'f': frames = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'F': fps = strtod(optarg, 0); break;
+            case 't': threads = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'c': clock = strtoul(optarg, 0, 0); break;
+            case 's': strips = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'd': device = optarg; break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!leds || !frames || !strips || (fps <= 0.0))
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    printf("%u LEDs, %u frames per strip, %u worker threads, %s%s\n", leds, frames, threads, device, clock ? " (emulated clock)" : "");
+    printf("%8s %12s %14s %14s %12s\n", "strips", "frames/s", "loop us/frame", "loop cpu %", "strips/core");
+
+    for (unsigned int count=1; count <= strips; count *= 2)
+    {
+        apa102::Loop loop;
+        apa102::Backend backend(loop, threads);
+        std::vector<std::unique_ptr<apa102::Bus>> buses;
+        std::vector<std::unique_ptr<apa102::Strip>> chain;
+        unsigned long errors = 0;
+
+        for (unsigned int i=0; i < count; i++)
+        {
+            buses.push_back(std::make_unique<apa102::Bus>(backend));
+
+            int status = buses.back()->open(device, (unsigned int)clock);
+
+            if (status)
+            {
+                fprintf(stderr, "%s: cannot open %s (%d)\n", argv[0], device, status);
+                return 1;
+            }
+            if (clock)
+            {
+                buses.back()->emulate(8000000000UL / clock);
+            }
+            chain.push_back(std::make_unique<apa102::Strip>(*buses.back(), leds));
+        }
+
+        double wall = bench_clock(CLOCK_MONOTONIC);
+        double cpu = bench_clock(CLOCK_THREAD_CPUTIME_ID);
+
+        for (unsigned int i=0; i < count; i++)
+        {
+            bench_strip(*chain[i], frames, i * 37, errors);
+        }
+        loop.run();
+
+        cpu = bench_clock(CLOCK_THREAD_CPUTIME_ID) - cpu;
+        wall = bench_clock(CLOCK_MONOTONIC) - wall;
+
+        double total = (double)count * frames;
+        double per_frame = cpu / total;
+
+        printf("%8u %12.0f %14.1f %14.1f %12.0f\n", count, total / wall, per_frame * 1e6, 100.0 * cpu / wall, 1.0 / (per_frame * fps));
+
+        if (errors)
+        {
+            fprintf(stderr, "%s: %lu failed transfers\n", argv[0], errors);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,638 @@
+/**
+ * @file apa102_audio.c
+ * @brief Host tool driving LED segments from an audio analysis pipeline.
+ *
+ * This host tool reads 16-bit PCM (a WAV file or a raw stream, e.g. from stdin) and analyses every hop of samples with a windowed fixed-point FFT. The spectrum is summed into log-spaced bands, normalised with a decaying peak and smoothed with separate attack and release. A beat detector compares the bass energy with its recent average and flashes the intensity of the strip. Every band drives one segment of the strip as bar graph (rendered with `apa102_segments()`), the frames are written to a device (e.g. `spidev`) or a file. The latency from a complete hop to the written frame is recorded and reported at the end.
+ *
+ * @code
+ * apa102_audio [-r rate] [-c channels] [-N fft] [-H hop] [-B bands] [-n leds] [-m] [-p] [-l limit_us] [-o output] [input.wav|-]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../apa102_segment.h"
+
+#define AUDIO_FFT_MAX     4096
+#define AUDIO_BANDS_MAX   64
+#define AUDIO_HISTORY     43
+#define AUDIO_BUCKET_US   10
+#define AUDIO_BUCKETS     4096
+#define AUDIO_RANGE       (16 << 8)         /* dynamic range of a band in log2 units (Q8), about 48 dB */
+#define AUDIO_PEAK_DECAY  2                 /* decay of the band peak per hop in log2 units (Q8) */
+#define AUDIO_ATTACK      200               /* smoothing factor (Q8) of rising levels */
+#define AUDIO_RELEASE     40                /* smoothing factor (Q8) of falling levels */
+#define AUDIO_BEAT        358               /* beat threshold (Q8) relative to the average bass energy, 1.4 */
+#define AUDIO_BEAT_GAP    200000            /* minimum time between beats in us */
+
+typedef struct
+{
+    /* input */
+    int input;
+    unsigned int rate;
+    unsigned int channels;
+    int pace;
+
+    /* analysis */
+    unsigned int size;
+    unsigned int hop;
+    unsigned int stages;
+    int16_t *samples;
+    int16_t window[AUDIO_FFT_MAX];
+    int32_t cosine[AUDIO_FFT_MAX / 2];
+    int32_t sine[AUDIO_FFT_MAX / 2];
+    unsigned int reverse[AUDIO_FFT_MAX];
+    int32_t real[AUDIO_FFT_MAX];
+    int32_t imaginary[AUDIO_FFT_MAX];
+
+    /* bands */
+    unsigned int bands;
+    unsigned int edge[AUDIO_BANDS_MAX + 1];
+    unsigned int bass;
+    int32_t peak[AUDIO_BANDS_MAX];
+    int32_t level[AUDIO_BANDS_MAX];
+    GFX_RGBA_Color hue[AUDIO_BANDS_MAX];
+
+    /* beat */
+    uint64_t history[AUDIO_HISTORY];
+    unsigned int history_index;
+    unsigned int history_count;
+    uint64_t last_beat;
+    unsigned int flash;
+    unsigned long beats;
+
+    /* output */
+    unsigned int length;
+    int mirror;
+    GFX_RGBA_Color *source;
+    APA102_Segment segment[AUDIO_BANDS_MAX];
+    int output;
+
+    /* latency */
+    unsigned long hops;
+    unsigned long over;
+    uint64_t limit;
+    uint64_t total;
+    uint64_t maximum;
+    unsigned long histogram[AUDIO_BUCKETS];
+} Audio_Context;
+
+static unsigned char *audio_wire;
+static unsigned long audio_wire_size;
+static unsigned long audio_wire_length;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    if (audio_wire_length < audio_wire_size)
+    {
+        audio_wire[audio_wire_length++] = data;
+    }
+    return data;
+}
+
+static uint64_t audio_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000ULL);
+}
+
+static int audio_read(int input, void *data, size_t length)
+{
+    unsigned char *position = data;
+
+    while (length)
+    {
+        ssize_t count = read(input, position, length);
+
+        if (count <= 0)
+        {
+            return -1;
+        }
+        position += count;
+        length -= (size_t)count;
+    }
+    return 0;
+}
+
+static uint32_t audio_le32(const unsigned char *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static int audio_wav(Audio_Context *context)
+{
+    unsigned char header[12];
+    unsigned char chunk[8];
+    int format = 0;
+
+    if (audio_read(context->input, header, sizeof(header)) || memcmp(header, "RIFF", 4) || memcmp(&header[8], "WAVE", 4))
+    {
+        return -1;
+    }
+
+    while (!audio_read(context->input, chunk, sizeof(chunk)))
+    {
+        uint32_t size = audio_le32(&chunk[4]);
+
+        if (!memcmp(chunk, "data", 4))
+        {
+            return format ? 0 : -1;
+        }
+
+        unsigned char data[64];
+        uint32_t skip = size + (size & 1);
+
+        if (!memcmp(chunk, "fmt ", 4) && (size >= 16) && (size <= sizeof(data)))
+        {
+            if (audio_read(context->input, data, skip))
+            {
+                return -1;
+            }
+
+            unsigned int tag = data[0] | (data[1] << 8);
+            unsigned int bits = data[14] | (data[15] << 8);
+
+            if (((tag != 1) && (tag != 0xFFFE)) || (bits != 16))
+            {
+                fprintf(stderr, "only 16-bit PCM is supported\n");
+                return -1;
+            }
+            context->channels = data[2] | (data[3] << 8);
+            context->rate = audio_le32(&data[4]);
+            format = 1;
+            continue;
+        }
+
+        while (skip)
+        {
+            uint32_t count = (skip > sizeof(data)) ? (uint32_t)sizeof(data) : skip;
+
+            if (audio_read(context->input, data, count))
+            {
+                return -1;
+            }
+            skip -= count;
+        }
+    }
+    return -1;
+}
+
+static void audio_setup(Audio_Context *context)
+{
+    const double pi = 3.14159265358979323846;
+
+    context->stages = 0;
+
+    while ((1U << context->stages) < context->size)
+    {
+        context->stages++;
+    }
+
+    for (unsigned int i=0; i < context->size; i++)
+    {
+        unsigned int reverse = 0;
+
+        for (unsigned int bit=0; bit < context->stages; bit++)
+        {
+            reverse |= ((i >> bit) & 1U) << (context->stages - 1 - bit);
+        }
+        context->reverse[i] = reverse;
+        context->window[i] = (int16_t)lround(32767.0 * (0.5 - (0.5 * cos((2.0 * pi * i) / context->size))));
+    }
+
+    for (unsigned int i=0; i < (context->size / 2); i++)
+    {
+        context->cosine[i] = (int32_t)lround(32767.0 * cos((2.0 * pi * i) / context->size));
+        context->sine[i] = (int32_t)lround(-32767.0 * sin((2.0 * pi * i) / context->size));
+    }
+
+    /* log-spaced band edges from 40 Hz up to 16 kHz (or the Nyquist frequency), at least one bin per band */
+    double low = 40.0;
+    double high = (context->rate / 2.0) < 16000.0 ? (context->rate / 2.0) : 16000.0;
+    unsigned int bins = context->size / 2;
+
+    context->bass = 0;
+
+    for (unsigned int band=0; band <= context->bands; band++)
+    {
+        double frequency = low * pow(high / low, (double)band / context->bands);
+        unsigned int edge = (unsigned int)lround((frequency * context->size) / context->rate);
+
+        if (band && (edge <= context->edge[band - 1]))
+        {
+            edge = context->edge[band - 1] + 1;
+        }
+        if (edge > bins)
+        {
+            edge = bins;
+        }
+        context->edge[band] = edge;
+
+        if (band && (frequency <= 150.0))
+        {
+            context->bass = band;
+        }
+    }
+    if (!context->bass)
+    {
+        context->bass = 1;
+    }
+
+    /* colors from red (bass) to blue (treble) */
+    for (unsigned int band=0; band < context->bands; band++)
+    {
+        unsigned int hue = (band * 1024U) / context->bands;
+        unsigned char rise = (unsigned char)(hue & 0xFF);
+        unsigned char fall = (unsigned char)(0xFF - rise);
+        GFX_RGBA_Color *color = &context->hue[band];
+
+        switch (hue >> 8)
+        {
+            case 0:  *color = (GFX_RGBA_Color){ 0, 0xFF, rise, 0x00 }; break;
+            case 1:  *color = (GFX_RGBA_Color){ 0, fall, 0xFF, 0x00 }; break;
+            case 2:  *color = (GFX_RGBA_Color){ 0, 0x00, 0xFF, rise }; break;
+            default: *color = (GFX_RGBA_Color){ 0, 0x00, fall, 0xFF }; break;
+        }
+    }
+
+    for (unsigned int band=0; band < context->bands; band++)
+    {
+        context->segment[band] = (APA102_Segment){ band * context->length, context->length, 1, 1, context->mirror ? APA102_Segment_Mirror : APA102_Segment_Forward };
+        context->peak[band] = AUDIO_RANGE;
+    }
+}
+
+/* radix-2 decimation in time, Q15 twiddles, every stage is scaled by 1/2 to stay in 16-bit range */
+static void audio_fft(Audio_Context *context)
+{
+    int32_t *real = context->real;
+    int32_t *imaginary = context->imaginary;
+
+    for (unsigned int half=1, step=context->size / 2; half < context->size; half <<= 1, step >>= 1)
+    {
+        for (unsigned int group=0; group < context->size; group += (half << 1))
+        {
+            int32_t *real_low = &real[group];
+            int32_t *real_high = &real[group + half];
+            int32_t *imaginary_low = &imaginary[group];
+            int32_t *imaginary_high = &imaginary[group + half];
+
+            for (unsigned int k=0; k < half; k++)
+            {
+                int32_t c = context->cosine[k * step];
+                int32_t s = context->sine[k * step];
+                int32_t x = real_high[k] >> 1;
+                int32_t y = imaginary_high[k] >> 1;
+                int32_t tr = ((x * c) - (y * s)) >> 15;
+                int32_t ti = ((x * s) + (y * c)) >> 15;
+                int32_t ur = real_low[k] >> 1;
+                int32_t ui = imaginary_low[k] >> 1;
+
+                real_low[k] = ur + tr;
+                imaginary_low[k] = ui + ti;
+                real_high[k] = ur - tr;
+                imaginary_high[k] = ui - ti;
+            }
+        }
+    }
+}
+
+/* log2 of a power in Q8 (linear interpolation of the mantissa) */
+static int32_t audio_log2(uint64_t value)
+{
+    if (!value)
+    {
+        return 0;
+    }
+
+    int exponent = 63 - __builtin_clzll(value);
+    uint64_t mantissa = (exponent >= 8) ? (value >> (exponent - 8)) : (value << (8 - exponent));
+
+    return (exponent << 8) + (int32_t)(mantissa & 0xFF);
+}
+
+static void audio_analyse(Audio_Context *context, uint64_t now)
+{
+    for (unsigned int i=0; i < context->size; i++)
+    {
+        unsigned int source = context->reverse[i];
+
+        context->real[i] = ((int32_t)context->samples[source] * context->window[source]) >> 15;
+        context->imaginary[i] = 0;
+    }
+
+    audio_fft(context);
+
+    uint64_t bass = 0;
+
+    for (unsigned int band=0; band < context->bands; band++)
+    {
+        uint64_t energy = 0;
+
+        for (unsigned int bin=context->edge[band]; bin < context->edge[band + 1]; bin++)
+        {
+            int64_t real = context->real[bin];
+            int64_t imaginary = context->imaginary[bin];
+
+            energy += (uint64_t)((real * real) + (imaginary * imaginary));
+        }
+
+        if (band < context->bass)
+        {
+            bass += energy;
+        }
+
+        /* normalise to the decaying peak of the band */
+        int32_t level = audio_log2(energy);
+
+        context->peak[band] -= AUDIO_PEAK_DECAY;
+
+        if (context->peak[band] < level)
+        {
+            context->peak[band] = level;
+        }
+        if (context->peak[band] < AUDIO_RANGE)
+        {
+            context->peak[band] = AUDIO_RANGE;
+        }
+
+        int32_t value = ((level - (context->peak[band] - AUDIO_RANGE)) * 255) / AUDIO_RANGE;
+
+        if (value < 0)
+        {
+            value = 0;
+        }
+
+        /* smoothing with fast attack and slow release (levels in Q8) */
+        int32_t difference = (value << 8) - context->level[band];
+
+        context->level[band] += (difference * ((difference > 0) ? AUDIO_ATTACK : AUDIO_RELEASE)) >> 8;
+    }
+
+    /* beat: bass energy above the average of the last hops */
+    uint64_t average = 0;
+
+    for (unsigned int i=0; i < context->history_count; i++)
+    {
+        average += context->history[i];
+    }
+    if (context->history_count)
+    {
+        average /= context->history_count;
+    }
+
+    if ((context->history_count == AUDIO_HISTORY) && (bass > ((average * AUDIO_BEAT) >> 8)) && (bass > (1ULL << 16)) && ((now - context->last_beat) >= AUDIO_BEAT_GAP))
+    {
+        context->last_beat = now;
+        context->flash = 255;
+        context->beats++;
+    }
+    else
+    {
+        context->flash = (context->flash * 220) >> 8;
+    }
+
+    context->history[context->history_index] = bass;
+    context->history_index = (context->history_index + 1) % AUDIO_HISTORY;
+
+    if (context->history_count < AUDIO_HISTORY)
+    {
+        context->history_count++;
+    }
+}
+
+static void audio_render(Audio_Context *context)
+{
+    unsigned char alpha = (unsigned char)(0x08 + ((context->flash * 23) >> 8));
+
+    for (unsigned int band=0; band < context->bands; band++)
+    {
+        GFX_RGBA_Color *bar = &context->source[band * context->length];
+        unsigned int fill = ((unsigned int)(context->level[band] >> 8) * context->length * 256U) / 255U;
+
+        for (unsigned int i=0; i < context->length; i++)
+        {
+            unsigned int scale = (fill >= ((i + 1) * 256U)) ? 256U : ((fill > (i * 256U)) ? (fill - (i * 256U)) : 0U);
+            const GFX_RGBA_Color *hue = &context->hue[band];
+
+            bar[i] = (GFX_RGBA_Color){ alpha, (unsigned char)((hue->red * scale) >> 8), (unsigned char)((hue->green * scale) >> 8), (unsigned char)((hue->blue * scale) >> 8) };
+        }
+    }
+
+    audio_wire_length = 0;
+    apa102_segments(context->source, context->segment, context->bands);
+}
+
+static void audio_record(Audio_Context *context, uint64_t latency)
+{
+    unsigned long bucket = (unsigned long)(latency / AUDIO_BUCKET_US);
+
+    context->histogram[(bucket < AUDIO_BUCKETS) ? bucket : (AUDIO_BUCKETS - 1)]++;
+    context->total += latency;
+    context->hops++;
+
+    if (latency > context->maximum)
+    {
+        context->maximum = latency;
+    }
+    if (latency > context->limit)
+    {
+        context->over++;
+    }
+}
+
+static uint64_t audio_percentile(const Audio_Context *context, unsigned int percent)
+{
+    unsigned long target = (unsigned long)(((unsigned long long)context->hops * percent + 99) / 100);
+    unsigned long count = 0;
+
+    for (unsigned int bucket=0; bucket < AUDIO_BUCKETS; bucket++)
+    {
+        count += context->histogram[bucket];
+
+        if (count >= target)
+        {
+            return (uint64_t)(bucket + 1) * AUDIO_BUCKET_US;
+        }
+    }
+    return context->maximum;
+}
+
+static void audio_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-r rate] [-c channels] [-N fft] [-H hop] [-B bands] [-n leds] [-m] [-p] [-l limit_us] [-o output] [input.wav|-]\n", name);
+    fprintf(stderr, "  input.wav  16-bit PCM WAV file, '-' or no file reads raw 16-bit PCM (-r, -c) from stdin\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static Audio_Context context;
+    const char *output = "/dev/null";
+    int raw = 1;
+    int option;
+
+    context.rate = 48000;
+    context.channels = 1;
+    context.size = 1024;
+    context.hop = 512;
+    context.bands = 16;
+    context.length = 8;
+    context.limit = 10000;
+
+    while ((option = getopt(argc, argv, "r:c:N:H:B:n:mpl:o:")) != -1)
+    {
+        switch (option)
+        {
+            case 'r': context.rate = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'c': context.channels = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'N': context.size = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'H': context.hop = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'B': context.bands = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'n': context.length = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'm': context.mirror = 1; break;
+            case 'p': context.pace = 1; break;
+            case 'l': context.limit = strtoull(optarg, 0, 0); break;
+            case 'o': output = optarg; break;
+            default:
+                audio_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((optind < argc) && strcmp(argv[optind], "-"))
+    {
+        context.input = open(argv[optind], O_RDONLY);
+
+        if ((context.input < 0) || audio_wav(&context))
+        {
+            fprintf(stderr, "%s: cannot read WAV file %s\n", argv[0], argv[optind]);
+            return 1;
+        }
+        raw = 0;
+    }
+
+    unsigned int leds = context.bands * context.length * (context.mirror ? 2U : 1U);
+
+    if ((context.size < 64) || (context.size > AUDIO_FFT_MAX) || (context.size & (context.size - 1)) || !context.hop || (context.hop > context.size) ||
+        !context.bands || (context.bands > AUDIO_BANDS_MAX) || (context.bands > (context.size / 4)) || !context.length || !context.rate || !context.channels ||
+        (leds > APA102_NUMBER_OF_LEDS))
+    {
+        fprintf(stderr, "%s: invalid configuration (at most %u LEDs, %u bands, FFT size a power of two up to %u)\n", argv[0], (unsigned int)APA102_NUMBER_OF_LEDS, AUDIO_BANDS_MAX, AUDIO_FFT_MAX);
+        audio_usage(argv[0]);
+        return 1;
+    }
+
+    context.output = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (context.output < 0)
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], output);
+        return 1;
+    }
+
+    context.samples = calloc(context.size, sizeof(int16_t));
+    context.source = calloc((size_t)context.bands * context.length, sizeof(GFX_RGBA_Color));
+    audio_wire_size = APA102_FRAME_SIZE + ((unsigned long)leds * APA102_LED_FRAME_SIZE) + APA102_EOF_SIZE;
+    audio_wire = malloc(audio_wire_size);
+
+    int16_t *block = malloc((size_t)context.hop * context.channels * sizeof(int16_t));
+
+    if (!context.samples || !context.source || !audio_wire || !block)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    }
+
+    audio_setup(&context);
+
+    fprintf(stderr, "%s %u Hz, %u channels, FFT %u, hop %u (%.2f ms), %u bands, %u LEDs\n", raw ? "raw" : "wav", context.rate, context.channels, context.size, context.hop, (context.hop * 1000.0) / context.rate, context.bands, leds);
+
+    uint64_t start = audio_now();
+    uint64_t clock = 0;
+
+    while (!audio_read(context.input, block, (size_t)context.hop * context.channels * sizeof(int16_t)))
+    {
+        if (context.pace)
+        {
+            uint64_t due = start + ((clock * 1000000ULL) / context.rate);
+            uint64_t now = audio_now();
+
+            if (due > now)
+            {
+                struct timespec delay = { (time_t)((due - now) / 1000000ULL), (long)(((due - now) % 1000000ULL) * 1000ULL) };
+
+                nanosleep(&delay, 0);
+            }
+        }
+        clock += context.hop;
+
+        /* hop complete: the latency is measured from here up to the written frame */
+        uint64_t ready = audio_now();
+
+        memmove(context.samples, &context.samples[context.hop], (context.size - context.hop) * sizeof(int16_t));
+
+        int16_t *samples = &context.samples[context.size - context.hop];
+
+        for (unsigned int i=0; i < context.hop; i++)
+        {
+            int32_t sum = 0;
+
+            for (unsigned int channel=0; channel < context.channels; channel++)
+            {
+                const unsigned char *sample = (const unsigned char *)&block[(i * context.channels) + channel];
+
+                sum += (int16_t)(sample[0] | (sample[1] << 8));
+            }
+            samples[i] = (int16_t)(sum / (int32_t)context.channels);
+        }
+
+        audio_analyse(&context, (clock * 1000000ULL) / context.rate);
+        audio_render(&context);
+
+        if (write(context.output, audio_wire, audio_wire_length) != (ssize_t)audio_wire_length)
+        {
+            fprintf(stderr, "%s: cannot write to %s\n", argv[0], output);
+            return 1;
+        }
+
+        audio_record(&context, audio_now() - ready);
+    }
+
+    if (context.hops)
+    {
+        fprintf(stderr, "%lu hops, %lu beats, latency avg %.1f us, p50 %llu us, p99 %llu us, max %llu us, %lu over %llu us\n",
+                context.hops, context.beats, (double)context.total / context.hops,
+                (unsigned long long)audio_percentile(&context, 50), (unsigned long long)audio_percentile(&context, 99),
+                (unsigned long long)context.maximum, context.over, (unsigned long long)context.limit);
+    }
+
+    free(block);
+    free(audio_wire);
+    free(context.source);
+    free(context.samples);
+    close(context.output);
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file apa102_calibration.c
+ * @brief Host tool generating a per-LED calibration table from measurement data.
+ *
+ * This host tool reads a CSV file with the measured intensity of the red, green and blue channel of every LED and generates the packed calibration table used by the per-LED calibration stage (see apa102_calibration.h) as C source.
+ *
+ * The CSV file contains one line per LED in the format `led,red,green,blue`. Lines that do not start with a number (e.g. a header) are ignored. The intensities can be in any unit as long as all LEDs were measured the same way.
+ *
+ * @code
+ * apa102_calibration [-s step] [-n name] measurement.csv > calibration.h
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CALIBRATION_MAX_LEDS 65535
+#define CALIBRATION_DEFAULT_STEP 4
+
+typedef struct
+{
+    double intensity[3];
+    int valid;
+} Calibration_Measurement;
+
+static void calibration_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-s step] [-n name] measurement.csv\n", name);
+    fprintf(stderr, "  -s step  gain change of a delta step, has to match APA102_CALIBRATION_STEP (default %d)\n", CALIBRATION_DEFAULT_STEP);
+    fprintf(stderr, "  -n name  name of the generated table (default apa102_calibration_table)\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *name = "apa102_calibration_table";
+    int step = CALIBRATION_DEFAULT_STEP;
+    int option;
+
+    while ((option = getopt(argc, argv, "s:n:h")) != -1)
+    {
+        switch (option)
+        {
+            case 's':
+                step = atoi(optarg);
+                break;
+            case 'n':
+                name = optarg;
+                break;
+            default:
+                calibration_usage(argv[0]);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (optind != argc - 1 || step < 1 || step > 32)
+    {
+        calibration_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FILE *file = fopen(argv[optind], "r");
+
+    if (!file)
+    {
+        perror(argv[optind]);
+        return EXIT_FAILURE;
+    }
+
+    Calibration_Measurement *measurements = calloc(CALIBRATION_MAX_LEDS, sizeof(Calibration_Measurement));
+    unsigned int leds = 0;
+    char line[256];
+
+    while (fgets(line, sizeof(line), file))
+    {
+        unsigned int led;
+        double red, green, blue;
+
+        if (sscanf(line, " %u , %lf , %lf , %lf", &led, &red, &green, &blue) != 4)
+        {
+            continue;
+        }
+        if (led >= CALIBRATION_MAX_LEDS || red <= 0.0 || green <= 0.0 || blue <= 0.0)
+        {
+            fprintf(stderr, "invalid measurement: %s", line);
+            fclose(file);
+            free(measurements);
+            return EXIT_FAILURE;
+        }
+        measurements[led].intensity[0] = red;
+        measurements[led].intensity[1] = green;
+        measurements[led].intensity[2] = blue;
+        measurements[led].valid = 1;
+
+        if (led + 1 > leds)
+        {
+            leds = led + 1;
+        }
+    }
+    fclose(file);
+
+    if (!leds)
+    {
+        fprintf(stderr, "%s: no measurements found\n", argv[optind]);
+        free(measurements);
+        return EXIT_FAILURE;
+    }
+
+    // Every LED is dimmed to the dimmest LED of the batch, the gains are therefore limited to 1.0
+    double minimum[3] = { INFINITY, INFINITY, INFINITY };
+    double average[3] = { 0.0, 0.0, 0.0 };
+    unsigned int measured = 0;
+
+    for (unsigned int led=0; led < leds; led++)
+    {
+        if (!measurements[led].valid)
+        {
+            continue;
+        }
+        for (unsigned int channel=0; channel < 3; channel++)
+        {
+            if (measurements[led].intensity[channel] < minimum[channel])
+            {
+                minimum[channel] = measurements[led].intensity[channel];
+            }
+        }
+        measured++;
+    }
+
+    for (unsigned int led=0; led < leds; led++)
+    {
+        if (!measurements[led].valid)
+        {
+            continue;
+        }
+        for (unsigned int channel=0; channel < 3; channel++)
+        {
+            average[channel] += 256.0 * minimum[channel] / measurements[led].intensity[channel] / measured;
+        }
+    }
+
+    unsigned int gain[3];
+
+    for (unsigned int channel=0; channel < 3; channel++)
+    {
+        long value = lround(average[channel]) - 1;
+        gain[channel] = (unsigned int)(value < 0 ? 0 : (value > 255 ? 255 : value));
+    }
+
+    // Pack three signed nibbles per LED, starting with the low nibble
+    unsigned int size = (leds * 3 + 1) / 2;
+    unsigned char *table = calloc(size, 1);
+    unsigned int clipped = 0;
+
+    for (unsigned int led=0; led < leds; led++)
+    {
+        for (unsigned int channel=0; channel < 3; channel++)
+        {
+            long delta = 0;
+
+            if (measurements[led].valid)
+            {
+                double target = 256.0 * minimum[channel] / measurements[led].intensity[channel];
+                delta = lround((target - (gain[channel] + 1)) / step);
+            }
+            if (delta < -8 || delta > 7)
+            {
+                delta = delta < -8 ? -8 : 7;
+                clipped++;
+            }
+
+            unsigned int nibble = led * 3 + channel;
+            table[nibble >> 1] |= (unsigned char)((delta & 0x0F) << ((nibble & 0x01) ? 4 : 0));
+        }
+    }
+
+    if (clipped)
+    {
+        fprintf(stderr, "warning: %u channel deltas exceed the range of a 4-bit delta, use a larger step\n", clipped);
+    }
+    if (measured != leds)
+    {
+        fprintf(stderr, "warning: %u LEDs without measurement use the batch average\n", leds - measured);
+    }
+
+    printf("// Generated by apa102_calibration from %s (%u LEDs, step %d)\n", argv[optind], leds, step);
+    printf("#if APA102_CALIBRATION_STEP != %d\n", step);
+    printf("    #error \"Calibration table generated with a different APA102_CALIBRATION_STEP\"\n");
+    printf("#endif\n\n");
+    printf("static const unsigned char %s_delta[%u] =\n{", name, size);
+
+    for (unsigned int i=0; i < size; i++)
+    {
+        printf("%s0x%02X%s", (i % 12) ? " " : "\n    ", table[i], (i + 1 < size) ? "," : "");
+    }
+    printf("\n};\n\n");
+    printf("static const APA102_Calibration %s =\n{\n", name);
+    printf("    { 0x%02X, 0x%02X, 0x%02X },\n", gain[0], gain[1], gain[2]);
+    printf("    %s_delta,\n", name);
+    printf("    %u\n};\n", leds);
+
+    free(table);
+    free(measurements);
+
+    return EXIT_SUCCESS;
+}
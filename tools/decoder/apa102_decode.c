@@ -0,0 +1,285 @@
+/**
+ * @file apa102_decode.c
+ * @brief Host tool decoding captures of the frame recorder.
+ *
+ * This host tool feeds a capture file of the frame recorder (see apa102_recorder.h) or a raw dump of the recorder ring buffer into the chain emulator and prints the LED states and the bus timing of every LED data sequence, followed by a summary.
+ *
+ * @code
+ * apa102_decode -n leds [-f apa102|hd108] [-c clock] [-r] [-v|-q] capture.bin
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../emulator/apa102_capture.h"
+
+#define DECODE_RECORDS 256
+#define DECODE_CHUNK 4096
+
+typedef struct
+{
+    unsigned long long offset;
+    unsigned long long start;
+    unsigned long long end;
+    unsigned long length;
+} Decode_Record;
+
+typedef struct
+{
+    Decode_Record records[DECODE_RECORDS];
+    unsigned long count;
+    int timestamps;
+    double clock;
+    int verbose;
+    int quiet;
+
+    unsigned long frames;
+    unsigned long violations;
+    unsigned long long bytes;
+    double bus_sum;
+    double bus_max;
+    double interval_sum;
+    double interval_min;
+    double interval_max;
+    unsigned long long first;
+    unsigned long long last;
+} Decode_Context;
+
+static const Decode_Record *decode_record(const Decode_Context *context, unsigned long long offset)
+{
+    unsigned long available = context->count < DECODE_RECORDS ? context->count : DECODE_RECORDS;
+
+    for (unsigned long i=0; i < available; i++)
+    {
+        const Decode_Record *record = &context->records[(context->count - 1 - i) % DECODE_RECORDS];
+
+        if (record->offset <= offset)
+        {
+            return record;
+        }
+    }
+    return 0;
+}
+
+static void decode_frame(const APA102_Emulator *emulator, const APA102_Emulator_Frame *frame, void *user)
+{
+    Decode_Context *context = user;
+    const Decode_Record *record = decode_record(context, frame->offset);
+    double bus = -1.0;
+
+    context->frames++;
+    context->bytes += frame->bytes;
+
+    if (frame->violations)
+    {
+        context->violations++;
+    }
+
+    if (context->timestamps && record)
+    {
+        if (record->offset + record->length >= frame->offset + frame->bytes)
+        {
+            bus = (double)(record->end - record->start) / 1000.0;
+        }
+        if (context->frames > 1)
+        {
+            double interval = (double)(record->start - context->last) / 1000.0;
+
+            context->interval_sum += interval;
+            if (context->frames == 2 || interval < context->interval_min)
+            {
+                context->interval_min = interval;
+            }
+            if (interval > context->interval_max)
+            {
+                context->interval_max = interval;
+            }
+        }
+        else
+        {
+            context->first = record->start;
+        }
+        context->last = record->start;
+    }
+    if (bus < 0.0 && context->clock > 0.0)
+    {
+        bus = frame->bytes * 8.0 / context->clock * 1e6;
+    }
+    if (bus >= 0.0)
+    {
+        context->bus_sum += bus;
+        if (bus > context->bus_max)
+        {
+            context->bus_max = bus;
+        }
+    }
+
+    if (context->quiet)
+    {
+        return;
+    }
+
+    printf("frame %lu offset %llu bytes %lu leds %u sof %lu eof %lu", frame->sequence, frame->offset, frame->bytes, frame->leds, frame->sof_bits, frame->eof_bits);
+
+    if (context->timestamps && record)
+    {
+        printf(" t %.6f", (double)(record->start - context->first) / 1e9);
+    }
+    if (bus >= 0.0)
+    {
+        printf(" bus %.1fus", bus);
+    }
+    if (frame->violations & APA102_Emulator_Header)
+    {
+        printf(" [header]");
+    }
+    if (frame->violations & APA102_Emulator_Eof)
+    {
+        printf(" [eof]");
+    }
+    printf("\n");
+
+    if (context->verbose)
+    {
+        for (unsigned int i=0; i < emulator->chain; i++)
+        {
+            const APA102_Emulator_LED *led = &emulator->leds[i];
+
+            printf("  %4u  %2u/%2u/%2u  %5u %5u %5u\n", i, led->gain[0], led->gain[1], led->gain[2], led->red, led->green, led->blue);
+        }
+    }
+}
+
+static void decode_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s -n leds [-f apa102|hd108] [-c clock] [-r] [-v|-q] capture\n", name);
+    fprintf(stderr, "  -n leds   number of LEDs in the chain\n");
+    fprintf(stderr, "  -f format frame format of raw dumps (default apa102)\n");
+    fprintf(stderr, "  -c clock  SPI clock in Hz to calculate the bus time of raw dumps\n");
+    fprintf(stderr, "  -r        input is a raw ring buffer dump without file header\n");
+    fprintf(stderr, "  -v        print the state of every LED after each sequence\n");
+    fprintf(stderr, "  -q        print the summary only\n");
+}
+
+int main(int argc, char *argv[])
+{
+    APA102_Emulator_Format format = APA102_Emulator_APA102;
+    Decode_Context *context = calloc(1, sizeof(Decode_Context));
+    unsigned int leds = 0;
+    int raw = 0;
+    int option;
+
+    while ((option = getopt(argc, argv, "n:f:c:rvqh")) != -1)
+    {
+        switch (option)
+        {
+            case 'n':
+                leds = (unsigned int)strtoul(optarg, 0, 0);
+                break;
+            case 'f':
+                format = strcmp(optarg, "hd108") ? APA102_Emulator_APA102 : APA102_Emulator_HD108;
+                break;
+            case 'c':
+                context->clock = strtod(optarg, 0);
+                break;
+            case 'r':
+                raw = 1;
+                break;
+            case 'v':
+                context->verbose = 1;
+                break;
+            case 'q':
+                context->quiet = 1;
+                break;
+            default:
+                decode_usage(argv[0]);
+                free(context);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (optind != argc - 1 || !leds)
+    {
+        decode_usage(argv[0]);
+        free(context);
+        return EXIT_FAILURE;
+    }
+
+    APA102_Capture capture;
+    APA102_Capture_Record current;
+    APA102_Emulator emulator;
+    unsigned char *buffer = malloc(DECODE_CHUNK);
+    unsigned long length;
+
+    if (apa102_capture_open(&capture, argv[optind], raw, format))
+    {
+        fprintf(stderr, "%s: cannot open capture (use -r for raw dumps)\n", argv[optind]);
+        free(buffer);
+        free(context);
+        return EXIT_FAILURE;
+    }
+    context->timestamps = !raw;
+
+    if (apa102_emulator_init(&emulator, capture.format, leds, decode_frame, context))
+    {
+        fprintf(stderr, "out of memory\n");
+        apa102_capture_close(&capture);
+        free(buffer);
+        free(context);
+        return EXIT_FAILURE;
+    }
+
+    while (apa102_capture_next(&capture, &current))
+    {
+        Decode_Record *record = &context->records[context->count++ % DECODE_RECORDS];
+
+        record->offset = current.offset;
+        record->start = current.start;
+        record->end = current.end;
+        record->length = current.length;
+
+        while ((length = apa102_capture_read(&capture, buffer, DECODE_CHUNK)) > 0)
+        {
+            apa102_emulator_feed(&emulator, buffer, length);
+        }
+    }
+    apa102_emulator_flush(&emulator);
+
+    printf("frames %lu, violations %lu, stray bytes %lu, bytes/frame %.1f",
+        context->frames, context->violations, emulator.stray, context->frames ? (double)context->bytes / context->frames : 0.0);
+
+    if (context->bus_max > 0.0)
+    {
+        printf(", bus time avg %.1fus max %.1fus", context->bus_sum / context->frames, context->bus_max);
+    }
+    if (context->frames > 1 && context->timestamps)
+    {
+        double average = context->interval_sum / (context->frames - 1);
+
+        printf(", interval avg %.1fus min %.1fus max %.1fus (%.1f fps)", average, context->interval_min, context->interval_max, average > 0.0 ? 1e6 / average : 0.0);
+    }
+    printf("\n");
+
+    int result = context->violations ? 2 : EXIT_SUCCESS;
+
+    apa102_capture_close(&capture);
+    apa102_emulator_free(&emulator);
+    free(buffer);
+    free(context);
+
+    return result;
+}
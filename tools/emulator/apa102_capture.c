@@ -0,0 +1,168 @@
+/**
+ * @file apa102_capture.c
+ * @brief Implementation of the capture reader for the host tools.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_capture.h"
+
+#include <string.h>
+
+static unsigned long long apa102_capture_le(const unsigned char *data, unsigned int length)
+{
+    unsigned long long value = 0;
+
+    while (length--)
+    {
+        value = (value << 8) | data[length];
+    }
+    return value;
+}
+
+/**
+ * @brief Open a capture file or a raw dump.
+ *
+ * @param capture Pointer to the capture state.
+ * @param path Path of the capture, `-` reads from the standard input.
+ * @param raw `0` for capture files of the recorder, `1` for raw dumps.
+ * @param format Frame format of raw dumps, capture files contain their frame format.
+ *
+ * @return `0` on success, `-1` if the file could not be opened or is not a capture file.
+ */
+int apa102_capture_open(APA102_Capture *capture, const char *path, int raw, APA102_Emulator_Format format)
+{
+    unsigned char header[8];
+
+    memset(capture, 0, sizeof(*capture));
+    capture->raw = raw;
+    capture->format = format;
+    capture->file = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+
+    if (!capture->file)
+    {
+        return -1;
+    }
+
+    if (!raw)
+    {
+        if (fread(header, 1, sizeof(header), capture->file) != sizeof(header) || memcmp(header, "A102", 4) || header[4] != 1)
+        {
+            apa102_capture_close(capture);
+            return -1;
+        }
+        capture->format = header[5] ? APA102_Emulator_HD108 : APA102_Emulator_APA102;
+    }
+    return 0;
+}
+
+/**
+ * @brief Close a capture.
+ *
+ * @param capture Pointer to the capture state.
+ */
+void apa102_capture_close(APA102_Capture *capture)
+{
+    if (capture->file && capture->file != stdin)
+    {
+        fclose(capture->file);
+    }
+    capture->file = 0;
+}
+
+/**
+ * @brief Advance to the next record of the capture.
+ *
+ * @param capture Pointer to the capture state.
+ * @param record Pointer where the information about the record is stored.
+ *
+ * @return `1` if a record is available, `0` at the end of the capture.
+ *
+ * @details
+ * Unread bytes of the previous record are skipped. The bytes of the record are read with `apa102_capture_read()`.
+ */
+int apa102_capture_next(APA102_Capture *capture, APA102_Capture_Record *record)
+{
+    unsigned char header[20];
+
+    while (capture->remaining)
+    {
+        unsigned char skip[256];
+
+        if (!apa102_capture_read(capture, skip, sizeof(skip)))
+        {
+            return 0;
+        }
+    }
+
+    memset(record, 0, sizeof(*record));
+    record->offset = capture->offset;
+
+    if (capture->raw)
+    {
+        int data = fgetc(capture->file);
+
+        if (data == EOF)
+        {
+            return 0;
+        }
+        ungetc(data, capture->file);
+
+        record->length = (unsigned long)-1;
+        capture->remaining = record->length;
+        return 1;
+    }
+
+    if (fread(header, 1, sizeof(header), capture->file) != sizeof(header))
+    {
+        return 0;
+    }
+
+    record->start = apa102_capture_le(&header[0], 8);
+    record->end = apa102_capture_le(&header[8], 8);
+    record->length = (unsigned long)apa102_capture_le(&header[16], 4);
+    capture->remaining = record->length;
+
+    return 1;
+}
+
+/**
+ * @brief Read bytes of the current record.
+ *
+ * @param capture Pointer to the capture state.
+ * @param buffer Buffer where the bytes are stored.
+ * @param size Size of the buffer.
+ *
+ * @return Number of bytes read, `0` at the end of the record.
+ */
+unsigned long apa102_capture_read(APA102_Capture *capture, unsigned char *buffer, unsigned long size)
+{
+    size_t length;
+
+    if (size > capture->remaining)
+    {
+        size = capture->remaining;
+    }
+
+    length = fread(buffer, 1, size, capture->file);
+
+    if (!length)
+    {
+        capture->remaining = 0;
+        return 0;
+    }
+
+    capture->remaining -= length;
+    capture->offset += length;
+
+    return (unsigned long)length;
+}
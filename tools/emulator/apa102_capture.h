@@ -0,0 +1,69 @@
+/**
+ * @file apa102_capture.h
+ * @brief Reader of frame recorder captures for the host tools.
+ *
+ * This header file defines a reader for capture files written by the frame recorder (see apa102_recorder.h) and raw dumps of the recorder ring buffer. The reader returns the records together with their timestamps, so the bytes can be fed into the chain emulator.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_CAPTURE_H_
+#define APA102_CAPTURE_H_
+
+    #include <stdio.h>
+
+    #include "apa102_emulator.h"
+
+    /**
+     * @struct APA102_Capture_Record_t
+     * @brief Information about a record of a capture.
+     *
+     * @details
+     * Raw dumps have no timestamps, `start` and `end` are `0` and the whole dump is returned as a single record.
+     */
+    struct APA102_Capture_Record_t
+    {
+        unsigned long long offset;  /**< Stream offset of the first byte of the record. */
+        unsigned long long start;   /**< Timestamp of the start-of-frame in nanoseconds. */
+        unsigned long long end;     /**< Timestamp after the end-of-frame in nanoseconds. */
+        unsigned long length;       /**< Number of bytes of the record. */
+    };
+    /**
+     * @typedef APA102_Capture_Record
+     * @brief Alias for struct APA102_Capture_Record_t representing a record of a capture.
+     */
+    typedef struct APA102_Capture_Record_t APA102_Capture_Record;
+
+    /**
+     * @struct APA102_Capture_t
+     * @brief State of an opened capture.
+     */
+    struct APA102_Capture_t
+    {
+        FILE *file;
+        int raw;
+        APA102_Emulator_Format format;
+        unsigned long long offset;
+        unsigned long remaining;
+    };
+    /**
+     * @typedef APA102_Capture
+     * @brief Alias for struct APA102_Capture_t representing an opened capture.
+     */
+    typedef struct APA102_Capture_t APA102_Capture;
+
+    int apa102_capture_open(APA102_Capture *capture, const char *path, int raw, APA102_Emulator_Format format);
+    void apa102_capture_close(APA102_Capture *capture);
+    int apa102_capture_next(APA102_Capture *capture, APA102_Capture_Record *record);
+    unsigned long apa102_capture_read(APA102_Capture *capture, unsigned char *buffer, unsigned long size);
+
+#endif /* APA102_CAPTURE_H_ */
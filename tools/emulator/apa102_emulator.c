@@ -0,0 +1,258 @@
+/**
+ * @file apa102_emulator.c
+ * @brief Implementation of the host emulator of an APA102 (or HD108) LED chain.
+ *
+ * The emulator follows the behaviour of a real chain: a LED data sequence starts after a start frame of zero bits, every following LED frame is taken by the next LED of the chain and a LED shows its new state once enough clocks followed its frame (every LED delays the data by half a clock). LED frames beyond the end of the chain are shifted out and only count as clocks.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include "apa102_emulator.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int apa102_emulator_header(const APA102_Emulator *emulator, unsigned char data)
+{
+    if (emulator->format == APA102_Emulator_HD108)
+    {
+        return (data & 0x80) == 0x80;
+    }
+    return (data & 0xE0) == 0xE0;
+}
+
+static void apa102_emulator_decode(const APA102_Emulator *emulator, const unsigned char *word, APA102_Emulator_LED *led)
+{
+    if (emulator->format == APA102_Emulator_HD108)
+    {
+        unsigned int header = ((unsigned int)word[0] << 8) | word[1];
+
+        led->gain[0] = (header >> 10) & 0x1F;
+        led->gain[1] = (header >> 5) & 0x1F;
+        led->gain[2] = header & 0x1F;
+        led->red = (unsigned short)((word[2] << 8) | word[3]);
+        led->green = (unsigned short)((word[4] << 8) | word[5]);
+        led->blue = (unsigned short)((word[6] << 8) | word[7]);
+    }
+    else
+    {
+        led->gain[0] = led->gain[1] = led->gain[2] = word[0] & 0x1F;
+        led->blue = word[1];
+        led->green = word[2];
+        led->red = word[3];
+    }
+}
+
+static void apa102_emulator_complete(APA102_Emulator *emulator)
+{
+    unsigned long led_bits = (unsigned long)emulator->frame.leds * emulator->frame_size * 8UL;
+
+    emulator->frame.eof_bits = emulator->data_bits - led_bits;
+
+    // The last received LED needs half a clock per preceding LED to receive its frame
+    if (emulator->frame.leds && emulator->frame.eof_bits < emulator->frame.leds / 2UL)
+    {
+        emulator->frame.violations |= APA102_Emulator_Eof;
+    }
+
+    memcpy(emulator->leds, emulator->pending, emulator->frame.leds * sizeof(APA102_Emulator_LED));
+    emulator->completed = 1;
+    emulator->sequences++;
+
+    if (emulator->callback)
+    {
+        emulator->callback(emulator, &emulator->frame, emulator->user);
+    }
+}
+
+static void apa102_emulator_finish(APA102_Emulator *emulator)
+{
+    if (emulator->active && !emulator->completed)
+    {
+        if (emulator->index)
+        {
+            emulator->frame.violations |= APA102_Emulator_Header;
+        }
+        apa102_emulator_complete(emulator);
+    }
+    emulator->active = 0;
+    emulator->index = 0;
+}
+
+static void apa102_emulator_start(APA102_Emulator *emulator)
+{
+    memset(&emulator->frame, 0, sizeof(emulator->frame));
+
+    emulator->frame.sequence = emulator->sequences;
+    emulator->frame.offset = emulator->offset - emulator->zeros;
+    emulator->frame.sof_bits = emulator->zeros * 8UL;
+    emulator->frame.bytes = emulator->zeros;
+    emulator->active = 1;
+    emulator->completed = 0;
+    emulator->index = 0;
+    emulator->data_bits = 0;
+}
+
+static void apa102_emulator_byte(APA102_Emulator *emulator, unsigned char data)
+{
+    if (!emulator->active)
+    {
+        if (!data)
+        {
+            emulator->zeros++;
+            return;
+        }
+        if (emulator->zeros < emulator->sof_size)
+        {
+            emulator->stray++;
+            emulator->zeros = 0;
+            return;
+        }
+        apa102_emulator_start(emulator);
+    }
+    else if (!data && (!emulator->index || emulator->completed))
+    {
+        // A zero byte can never start a LED frame, it is the beginning of the next start frame. Once the chain is complete the remaining bytes are clocks only and need not be aligned to LED frames.
+        if (++emulator->zeros >= emulator->sof_size)
+        {
+            apa102_emulator_finish(emulator);
+        }
+        return;
+    }
+    else if (emulator->zeros && !emulator->completed)
+    {
+        emulator->frame.violations |= APA102_Emulator_Header;
+        apa102_emulator_finish(emulator);
+
+        emulator->stray += emulator->zeros + 1;
+        emulator->zeros = 0;
+        return;
+    }
+
+    emulator->zeros = 0;
+    emulator->word[emulator->index++] = data;
+    emulator->data_bits += 8;
+
+    if (!emulator->completed)
+    {
+        emulator->frame.bytes++;
+    }
+
+    if (emulator->index == emulator->frame_size)
+    {
+        emulator->index = 0;
+
+        if (emulator->completed)
+        {
+            return;
+        }
+        if (!apa102_emulator_header(emulator, emulator->word[0]))
+        {
+            emulator->frame.violations |= APA102_Emulator_Header;
+        }
+        else if (emulator->frame.leds < emulator->chain)
+        {
+            apa102_emulator_decode(emulator, emulator->word, &emulator->pending[emulator->frame.leds++]);
+        }
+    }
+
+    if (!emulator->completed && emulator->frame.leds == emulator->chain)
+    {
+        unsigned long led_bits = (unsigned long)emulator->chain * emulator->frame_size * 8UL;
+
+        if (emulator->data_bits - led_bits >= emulator->chain / 2UL)
+        {
+            apa102_emulator_complete(emulator);
+        }
+    }
+}
+
+/**
+ * @brief Initialize an emulated LED chain.
+ *
+ * @param emulator Pointer to the emulator state.
+ * @param format Frame format of the LEDs in the chain.
+ * @param chain Number of LEDs in the chain.
+ * @param callback Function called for every completed LED data sequence (may be `NULL`).
+ * @param user Pointer passed to the callback.
+ *
+ * @return `0` on success, `-1` if the LED states could not be allocated.
+ *
+ * @details
+ * All LEDs start switched off. The start frame has to consist of at least 4 (APA102) or 16 (HD108) zero bytes, the same sizes the driver sends by default.
+ */
+int apa102_emulator_init(APA102_Emulator *emulator, APA102_Emulator_Format format, unsigned int chain, APA102_Emulator_Callback callback, void *user)
+{
+    memset(emulator, 0, sizeof(*emulator));
+
+    emulator->format = format;
+    emulator->chain = chain;
+    emulator->frame_size = (format == APA102_Emulator_HD108) ? 8 : 4;
+    emulator->sof_size = (format == APA102_Emulator_HD108) ? 16 : 4;
+    emulator->callback = callback;
+    emulator->user = user;
+    emulator->leds = calloc(chain ? chain : 1, sizeof(APA102_Emulator_LED));
+    emulator->pending = calloc(chain ? chain : 1, sizeof(APA102_Emulator_LED));
+
+    if (!emulator->leds || !emulator->pending)
+    {
+        apa102_emulator_free(emulator);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Release the LED states of an emulated LED chain.
+ *
+ * @param emulator Pointer to the emulator state.
+ */
+void apa102_emulator_free(APA102_Emulator *emulator)
+{
+    free(emulator->leds);
+    free(emulator->pending);
+
+    emulator->leds = 0;
+    emulator->pending = 0;
+}
+
+/**
+ * @brief Feed transmitted bytes into the emulated LED chain.
+ *
+ * @param emulator Pointer to the emulator state.
+ * @param data Pointer to the bytes sent via SPI.
+ * @param length Number of bytes.
+ *
+ * @details
+ * A LED data sequence is completed as soon as every LED of the chain received its frame and enough clocks, or when the next start frame begins. The callback is called after the LED states were latched.
+ */
+void apa102_emulator_feed(APA102_Emulator *emulator, const unsigned char *data, unsigned long length)
+{
+    while (length--)
+    {
+        apa102_emulator_byte(emulator, *data++);
+        emulator->offset++;
+    }
+}
+
+/**
+ * @brief Complete a pending LED data sequence at the end of the stream.
+ *
+ * @param emulator Pointer to the emulator state.
+ *
+ * @details
+ * A sequence that was not completed by enough clocks is latched anyway and reported with `APA102_Emulator_Eof`.
+ */
+void apa102_emulator_flush(APA102_Emulator *emulator)
+{
+    apa102_emulator_finish(emulator);
+}
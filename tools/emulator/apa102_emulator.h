@@ -0,0 +1,143 @@
+/**
+ * @file apa102_emulator.h
+ * @brief Host emulator of an APA102 (or HD108) LED chain.
+ *
+ * This header file defines a byte-level emulator of a LED chain. The emulator consumes the SPI byte stream sent by the driver, detects start-of-frame markers, decodes the LED frames and latches them into the LED states of the chain. Protocol violations (invalid LED frame headers, short start frames and missing end-of-frame clocks) are reported per frame.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_EMULATOR_H_
+#define APA102_EMULATOR_H_
+
+    /**
+     * @enum APA102_Emulator_Format_t
+     * @brief Enumerates the frame formats understood by the emulator (same values as `APA102_FRAME_FORMAT`).
+     */
+    enum APA102_Emulator_Format_t
+    {
+        APA102_Emulator_APA102=0,
+        APA102_Emulator_HD108=1
+    };
+    /**
+     * @typedef APA102_Emulator_Format
+     * @brief Alias for enum APA102_Emulator_Format_t representing the frame format of the emulated chain.
+     */
+    typedef enum APA102_Emulator_Format_t APA102_Emulator_Format;
+
+    /**
+     * @enum APA102_Emulator_Violation_t
+     * @brief Enumerates the protocol violations detected by the emulator (bit mask).
+     */
+    enum APA102_Emulator_Violation_t
+    {
+        APA102_Emulator_Header=0x01,    /**< A LED frame did not start with the header bits (`0b111` or `0b1`). */
+        APA102_Emulator_Eof=0x02,       /**< Not enough clocks after the last LED frame to latch every LED. */
+        APA102_Emulator_Sof=0x04        /**< Bytes were sent without a preceding start frame of zero bits. */
+    };
+    /**
+     * @typedef APA102_Emulator_Violation
+     * @brief Alias for enum APA102_Emulator_Violation_t representing a protocol violation.
+     */
+    typedef enum APA102_Emulator_Violation_t APA102_Emulator_Violation;
+
+    /**
+     * @struct APA102_Emulator_LED_t
+     * @brief State of a single emulated LED.
+     *
+     * @details
+     * The `gain` holds the 5-bit intensity of the red, green and blue channel (the APA102 uses the same intensity for all channels). The color components hold 8-bit (APA102) or 16-bit (HD108) values.
+     */
+    struct APA102_Emulator_LED_t
+    {
+        unsigned char gain[3];
+        unsigned short red;
+        unsigned short green;
+        unsigned short blue;
+    };
+    /**
+     * @typedef APA102_Emulator_LED
+     * @brief Alias for struct APA102_Emulator_LED_t representing the state of an emulated LED.
+     */
+    typedef struct APA102_Emulator_LED_t APA102_Emulator_LED;
+
+    /**
+     * @struct APA102_Emulator_Frame_t
+     * @brief Information about a completed LED data sequence.
+     */
+    struct APA102_Emulator_Frame_t
+    {
+        unsigned long sequence;     /**< Number of the sequence, starting with `0`. */
+        unsigned long long offset;  /**< Stream offset of the first start frame byte. */
+        unsigned long bytes;        /**< Bytes from the start frame up to the completion of the sequence. */
+        unsigned long sof_bits;     /**< Zero bits of the start frame. */
+        unsigned long eof_bits;     /**< Bits clocked after the last LED frame of the chain. */
+        unsigned int leds;          /**< LED frames received for the chain. */
+        unsigned int violations;    /**< Bit mask of `APA102_Emulator_Violation`. */
+    };
+    /**
+     * @typedef APA102_Emulator_Frame
+     * @brief Alias for struct APA102_Emulator_Frame_t representing a completed LED data sequence.
+     */
+    typedef struct APA102_Emulator_Frame_t APA102_Emulator_Frame;
+
+    struct APA102_Emulator_t;
+
+    /**
+     * @typedef APA102_Emulator_Callback
+     * @brief Function called for every completed LED data sequence, after the LED states were latched.
+     */
+    typedef void (*APA102_Emulator_Callback)(const struct APA102_Emulator_t *emulator, const APA102_Emulator_Frame *frame, void *user);
+
+    /**
+     * @struct APA102_Emulator_t
+     * @brief State of an emulated LED chain.
+     *
+     * @details
+     * Initialize the emulator with `apa102_emulator_init()`. The LED states of the chain can be read from `leds` at any time.
+     */
+    struct APA102_Emulator_t
+    {
+        APA102_Emulator_Format format;
+        unsigned int chain;
+        APA102_Emulator_LED *leds;
+        APA102_Emulator_LED *pending;
+
+        unsigned char frame_size;
+        unsigned char sof_size;
+        unsigned char word[8];
+        unsigned char index;
+        unsigned char active;
+        unsigned char completed;
+        unsigned long zeros;
+        unsigned long data_bits;
+        APA102_Emulator_Frame frame;
+
+        unsigned long long offset;
+        unsigned long sequences;
+        unsigned long stray;
+
+        APA102_Emulator_Callback callback;
+        void *user;
+    };
+    /**
+     * @typedef APA102_Emulator
+     * @brief Alias for struct APA102_Emulator_t representing an emulated LED chain.
+     */
+    typedef struct APA102_Emulator_t APA102_Emulator;
+
+    int apa102_emulator_init(APA102_Emulator *emulator, APA102_Emulator_Format format, unsigned int chain, APA102_Emulator_Callback callback, void *user);
+    void apa102_emulator_free(APA102_Emulator *emulator);
+    void apa102_emulator_feed(APA102_Emulator *emulator, const unsigned char *data, unsigned long length);
+    void apa102_emulator_flush(APA102_Emulator *emulator);
+
+#endif /* APA102_EMULATOR_H_ */
@@ -0,0 +1,94 @@
+/**
+ * @file fuzz_emulator.c
+ * @brief Fuzz target of the chain emulator used to decode captured byte streams.
+ *
+ * The input selects the frame format and the length of the chain, the remaining bytes are fed as byte stream. The emulator must not access memory outside the chain and has to report consistent frame information for arbitrary streams.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../emulator/apa102_emulator.h"
+
+typedef struct
+{
+    unsigned long frames;
+    unsigned long long offset;
+    unsigned long long size;
+} Fuzz_Context;
+
+static void fuzz_frame(const APA102_Emulator *emulator, const APA102_Emulator_Frame *frame, void *user)
+{
+    Fuzz_Context *context = user;
+
+    if (frame->sequence != context->frames++)
+    {
+        abort();
+    }
+    if (frame->leds > emulator->chain || frame->sof_bits < emulator->sof_size * 8UL)
+    {
+        abort();
+    }
+    if (frame->offset < context->offset || frame->offset + frame->bytes > context->size)
+    {
+        abort();
+    }
+    if (frame->bytes < frame->sof_bits / 8 + (unsigned long)frame->leds * emulator->frame_size)
+    {
+        abort();
+    }
+    context->offset = frame->offset + frame->bytes;
+
+    for (unsigned int i=0; i < frame->leds; i++)
+    {
+        if (emulator->leds[i].gain[0] > 0x1F || emulator->leds[i].gain[1] > 0x1F || emulator->leds[i].gain[2] > 0x1F)
+        {
+            abort();
+        }
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    APA102_Emulator emulator;
+    Fuzz_Context context = { 0, 0, 0 };
+
+    if (size < 2)
+    {
+        return 0;
+    }
+
+    APA102_Emulator_Format format = (data[0] & 0x80) ? APA102_Emulator_HD108 : APA102_Emulator_APA102;
+    unsigned int chain = 1 + ((data[0] & 0x7F) << 8 | data[1]) % 512;
+
+    context.size = size - 2;
+
+    if (apa102_emulator_init(&emulator, format, chain, fuzz_frame, &context))
+    {
+        abort();
+    }
+
+    // Feed in two parts to cover sequences split across records
+    apa102_emulator_feed(&emulator, data + 2, (size - 2) / 2);
+    apa102_emulator_feed(&emulator, data + 2 + (size - 2) / 2, (size - 2) - (size - 2) / 2);
+    apa102_emulator_flush(&emulator);
+
+    if (emulator.sequences != context.frames)
+    {
+        abort();
+    }
+    apa102_emulator_free(&emulator);
+
+    return 0;
+}
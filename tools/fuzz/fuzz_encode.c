@@ -0,0 +1,167 @@
+/**
+ * @file fuzz_encode.c
+ * @brief Fuzz target of the LED frame encoding of the APA102 LED driver.
+ *
+ * The input selects the number of LEDs and their colors and intensities. The bytes the driver sends for `apa102_led()` sequences, `apa102_encode()` with `apa102_write()`, `apa102_leds()` and `apa102_leds_off()` are fed into the chain emulator, which has to latch exactly the expected LED states without any protocol violation (LED frame headers, start frame of zero bits and enough end frame clocks).
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../apa102.h"
+#include "../emulator/apa102_emulator.h"
+
+#define FUZZ_BUFFER_SIZE ((APA102_NUMBER_OF_LEDS * APA102_LED_FRAME_SIZE) + APA102_FRAME_SIZE + APA102_EOF_SIZE + 64)
+
+static unsigned char fuzz_buffer[FUZZ_BUFFER_SIZE];
+static unsigned long fuzz_length;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    if (fuzz_length >= FUZZ_BUFFER_SIZE)
+    {
+        abort();
+    }
+    fuzz_buffer[fuzz_length++] = data;
+
+    return 0;
+}
+
+static void fuzz_frame(const APA102_Emulator *emulator, const APA102_Emulator_Frame *frame, void *user)
+{
+    unsigned long *frames = user;
+
+    (void)emulator;
+    (*frames)++;
+
+    if (frame->violations || frame->leds != emulator->chain)
+    {
+        abort();
+    }
+    if (frame->sof_bits < APA102_FRAME_SIZE * 8UL || frame->eof_bits < emulator->chain / 2UL)
+    {
+        abort();
+    }
+}
+
+static void fuzz_check(unsigned int chain, const GFX_RGBA_Color *colors, unsigned int step)
+{
+    APA102_Emulator emulator;
+    unsigned long frames = 0;
+
+    if (apa102_emulator_init(&emulator, (APA102_Emulator_Format)APA102_FRAME_FORMAT, chain, fuzz_frame, &frames))
+    {
+        abort();
+    }
+    apa102_emulator_feed(&emulator, fuzz_buffer, fuzz_length);
+    apa102_emulator_flush(&emulator);
+
+    if (frames != 1 || emulator.stray)
+    {
+        abort();
+    }
+
+    for (unsigned int i=0; i < chain; i++)
+    {
+        const GFX_RGBA_Color *color = &colors[i * step];
+        const APA102_Emulator_LED *led = &emulator.leds[i];
+        unsigned int scale = (APA102_FRAME_FORMAT == APA102_FORMAT_HD108) ? 257 : 1;
+
+        if (led->gain[0] != (color->alpha & APA102_MAX_INTENSITY) || led->gain[1] != led->gain[0] || led->gain[2] != led->gain[0])
+        {
+            abort();
+        }
+        if (led->red != color->red * scale || led->green != color->green * scale || led->blue != color->blue * scale)
+        {
+            abort();
+        }
+    }
+    apa102_emulator_free(&emulator);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    static GFX_RGBA_Color colors[APA102_NUMBER_OF_LEDS];
+    static unsigned char encoded[APA102_NUMBER_OF_LEDS * APA102_LED_FRAME_SIZE];
+    static unsigned char reference[FUZZ_BUFFER_SIZE];
+    unsigned int leds;
+
+    if (size < 1)
+    {
+        return 0;
+    }
+
+    leds = 1 + (data[0] % APA102_NUMBER_OF_LEDS);
+    data++;
+    size--;
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        unsigned char value[4] = { 0, 0, 0, 0 };
+
+        for (unsigned int j=0; j < 4 && size; j++)
+        {
+            value[j] = data[(i * 4 + j) % size];
+        }
+        colors[i].alpha = value[0];
+        colors[i].red = value[1];
+        colors[i].green = value[2];
+        colors[i].blue = value[3];
+    }
+
+    // Single LED frames between start and end frame
+    fuzz_length = 0;
+    APA102_SOF();
+    for (unsigned int i=0; i < leds; i++)
+    {
+        apa102_led(&colors[i]);
+    }
+    APA102_EOF();
+    fuzz_check(leds, colors, 1);
+
+    // Encoded in advance and sent as bulk, the bytes on the wire have to be identical
+    unsigned long length = fuzz_length;
+
+    memcpy(reference, fuzz_buffer, length);
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        apa102_encode(i, APA102_START_FLAG | (0x3F & colors[i].alpha), &colors[i], &encoded[i * APA102_LED_FRAME_SIZE]);
+    }
+    fuzz_length = 0;
+    APA102_SOF();
+    apa102_write(encoded, leds * APA102_LED_FRAME_SIZE);
+    APA102_EOF();
+
+    if (fuzz_length != length || memcmp(reference, fuzz_buffer, length))
+    {
+        abort();
+    }
+
+    // Same color on the whole chain
+    fuzz_length = 0;
+    apa102_leds(&colors[0]);
+    fuzz_check(APA102_NUMBER_OF_LEDS, colors, 0);
+
+    // Switched off chain
+    GFX_RGBA_Color off = { 0 };
+
+    off.alpha = APA102_MIN_INTENSITY;
+    fuzz_length = 0;
+    apa102_leds_off();
+    fuzz_check(APA102_NUMBER_OF_LEDS, &off, 0);
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file fuzz_main.c
+ * @brief Standalone driver for the fuzz targets without libFuzzer.
+ *
+ * Compilers without libFuzzer (e.g. gcc) link the fuzz targets with this driver. Every file given on the command line is run once, without arguments a fixed number of pseudo random inputs is generated. This is used to replay crashes and as a quick smoke test.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FUZZ_ITERATIONS 100000
+#define FUZZ_MAX_SIZE 4096
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int main(int argc, char *argv[])
+{
+    static uint8_t data[FUZZ_MAX_SIZE];
+
+    if (argc > 1)
+    {
+        for (int i=1; i < argc; i++)
+        {
+            FILE *file = fopen(argv[i], "rb");
+
+            if (!file)
+            {
+                perror(argv[i]);
+                return EXIT_FAILURE;
+            }
+            size_t size = fread(data, 1, sizeof(data), file);
+            fclose(file);
+
+            LLVMFuzzerTestOneInput(data, size);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    srand(0xA102);
+
+    for (unsigned long iteration=0; iteration < FUZZ_ITERATIONS; iteration++)
+    {
+        size_t size = (size_t)rand() % FUZZ_MAX_SIZE;
+
+        for (size_t i=0; i < size; i++)
+        {
+            data[i] = (uint8_t)rand();
+        }
+
+        // Sprinkle start frames, so the emulator sees valid sequences as well
+        if (size > 16 && (iteration & 0x01))
+        {
+            for (size_t i=(size_t)rand() % (size - 8), end=i + 8; i < end; i++)
+            {
+                data[i] = 0x00;
+            }
+        }
+        LLVMFuzzerTestOneInput(data, size);
+    }
+    printf("%d inputs passed\n", FUZZ_ITERATIONS);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * @file spi.h
+ * @brief SPI shim for building the APA102 LED driver on the development host.
+ *
+ * The host tools compile the driver with `-DAPA102_HAL_SPI='"tools/host/spi.h"'` instead of a platform hardware abstraction layer. Every tool provides its own `spi_transfer()` (e.g. collecting the bytes in a buffer or writing them to `spidev`).
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_HOST_SPI_H_
+#define APA102_HOST_SPI_H_
+
+    unsigned char spi_transfer(unsigned char data);
+
+#endif /* APA102_HOST_SPI_H_ */
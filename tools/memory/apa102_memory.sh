@@ -0,0 +1,45 @@
+#!/bin/sh
+#
+# Static RAM report of the APA102 LED driver
+#
+# Compiles apa102_memory.c with the compiler and flags of the project and
+# prints the static RAM of every enabled feature. The values are evaluated by
+# the target compiler, so type sizes match the target (e.g. 16-bit int on AVR).
+#
+# usage: CC=avr-gcc NM=avr-nm apa102_memory.sh [compiler flags of the project]
+#
+# example:
+#   CC=avr-gcc NM=avr-nm ./apa102_memory.sh -mmcu=attiny1616 \
+#       -DAPA102_NUMBER_OF_LEDS=60 -DAPA102_CORRECTION_AVAILABLE -DAPA102_RAM_BUDGET=1024
+
+CC=${CC:-cc}
+NM=${NM:-nm}
+DRIVER=$(cd "$(dirname "$0")/../.." && pwd)
+OBJECT=$(mktemp "${TMPDIR:-/tmp}/apa102_memory.XXXXXX")
+
+trap 'rm -f "$OBJECT"' EXIT
+
+"$CC" "$@" -DAPA102_RAM_REPORT -c "$DRIVER/apa102_memory.c" -o "$OBJECT" || exit 1
+
+"$NM" -S "$OBJECT" | awk '
+    $4 ~ /^apa102_ram_/ {
+        name = substr($4, 12)
+        size = 0
+        digits = toupper($2)
+        for (i = 1; i <= length(digits); i++)
+        {
+            size = size * 16 + index("0123456789ABCDEF", substr(digits, i, 1)) - 1
+        }
+        size = size - 1
+        if (name == "total")
+        {
+            total = size
+        }
+        else
+        {
+            printf "%-16s %8d bytes\n", name, size
+        }
+    }
+    END {
+        printf "%-16s %8d bytes\n", "total", total
+    }'
@@ -0,0 +1,270 @@
+/**
+ * @file apa102_noise_bench.c
+ * @brief Benchmark of the fixed-point simplex noise against a float reference.
+ *
+ * This host tool calculates frames of three-dimensional noise (position along the strip, row, time) for strips of different length with a float reference implementation (same permutation and gradients), the fixed-point point function and the incremental fixed-point line function. It prints the time per LED, the share of the frame budget and the deviation of the fixed-point values from the reference, and checks that the line functions return the same values as the point functions.
+ *
+ * @code
+ * apa102_noise_bench [-f frames] [-F fps] [-s step]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../apa102_noise.h"
+
+/* skew factors of the fixed-point lattice ((sqrt(3) - 1) / 2 and 1 / 3 in 1/65536), the reference calculates the same noise field */
+#define BENCH_F2 (23987.0 / 65536.0)
+#define BENCH_F3 (21845.0 / 65536.0)
+
+unsigned char spi_transfer(unsigned char data)
+{
+    return data;
+}
+
+static double bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void bench_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-f frames] [-F fps] [-s step]\n", name);
+}
+
+static int bench_hash(int value)
+{
+    return apa102_noise_permutation[value & 0xFF];
+}
+
+static double bench_dot(int gradient, double x, double y, double z)
+{
+    return (apa102_noise_gradients[gradient][0] * x) + (apa102_noise_gradients[gradient][1] * y) + (apa102_noise_gradients[gradient][2] * z);
+}
+
+static double bench_falloff(double radius, int gradient, double x, double y, double z)
+{
+    double t = radius - (x * x) - (y * y) - (z * z);
+
+    return (t > 0.0) ? (t * t * t * t * bench_dot(gradient, x, y, z)) : 0.0;
+}
+
+/* float reference of the one-dimensional noise */
+static double bench_reference1(double x)
+{
+    const int i = (int)floor(x);
+    double value = 0.0;
+
+    for (int corner=0; corner < 2; corner++)
+    {
+        const int hash = bench_hash(i + corner);
+        const double offset = x - i - corner;
+        const double t = 1.0 - (offset * offset);
+        const double gradient = (1 + (hash & 0x07)) * ((hash & 0x08) ? -1.0 : 1.0);
+
+        value += t * t * t * t * gradient * offset;
+    }
+    return 0.395 * value;
+}
+
+/* float reference of the two-dimensional noise */
+static double bench_reference2(double x, double y)
+{
+    const double f2 = BENCH_F2;
+    const double g2 = f2 / (1.0 + (2.0 * f2));
+    const double skew = (x + y) * f2;
+    const int i = (int)floor(x + skew);
+    const int j = (int)floor(y + skew);
+    const double unskew = (i + j) * g2;
+    const double x0 = x - (i - unskew);
+    const double y0 = y - (j - unskew);
+    const int i1 = (x0 > y0) ? 1 : 0;
+    const int j1 = 1 - i1;
+
+    return 70.0 * (bench_falloff(0.5, bench_hash(i + bench_hash(j)) & 0x0F, x0, y0, 0.0)
+                 + bench_falloff(0.5, bench_hash(i + i1 + bench_hash(j + j1)) & 0x0F, x0 - i1 + g2, y0 - j1 + g2, 0.0)
+                 + bench_falloff(0.5, bench_hash(i + 1 + bench_hash(j + 1)) & 0x0F, x0 - 1.0 + (2.0 * g2), y0 - 1.0 + (2.0 * g2), 0.0));
+}
+
+/* float reference of the three-dimensional noise */
+static double bench_reference3(double x, double y, double z)
+{
+    const double g3 = BENCH_F3 / (1.0 + (3.0 * BENCH_F3));
+    const double skew = (x + y + z) * BENCH_F3;
+    const int i = (int)floor(x + skew);
+    const int j = (int)floor(y + skew);
+    const int k = (int)floor(z + skew);
+    const double unskew = (i + j + k) * g3;
+    const double x0 = x - (i - unskew);
+    const double y0 = y - (j - unskew);
+    const double z0 = z - (k - unskew);
+    int i1, j1, k1, i2, j2, k2;
+
+    if (x0 >= y0)
+    {
+        if (y0 >= z0)      { i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 1; k2 = 0; }
+        else if (x0 >= z0) { i1 = 1; j1 = 0; k1 = 0; i2 = 1; j2 = 0; k2 = 1; }
+        else               { i1 = 0; j1 = 0; k1 = 1; i2 = 1; j2 = 0; k2 = 1; }
+    }
+    else
+    {
+        if (y0 < z0)       { i1 = 0; j1 = 0; k1 = 1; i2 = 0; j2 = 1; k2 = 1; }
+        else if (x0 < z0)  { i1 = 0; j1 = 1; k1 = 0; i2 = 0; j2 = 1; k2 = 1; }
+        else               { i1 = 0; j1 = 1; k1 = 0; i2 = 1; j2 = 1; k2 = 0; }
+    }
+
+    return 32.0 * (bench_falloff(0.6, bench_hash(i + bench_hash(j + bench_hash(k))) & 0x0F, x0, y0, z0)
+                 + bench_falloff(0.6, bench_hash(i + i1 + bench_hash(j + j1 + bench_hash(k + k1))) & 0x0F, x0 - i1 + g3, y0 - j1 + g3, z0 - k1 + g3)
+                 + bench_falloff(0.6, bench_hash(i + i2 + bench_hash(j + j2 + bench_hash(k + k2))) & 0x0F, x0 - i2 + (2.0 * g3), y0 - j2 + (2.0 * g3), z0 - k2 + (2.0 * g3))
+                 + bench_falloff(0.6, bench_hash(i + 1 + bench_hash(j + 1 + bench_hash(k + 1))) & 0x0F, x0 - 1.0 + (3.0 * g3), y0 - 1.0 + (3.0 * g3), z0 - 1.0 + (3.0 * g3)));
+}
+
+int main(int argc, char *argv[])
+{
+    static const unsigned int lengths[] = { 30, 60, 300, 1000, 10000 };
+    unsigned int frames = 200;
+    unsigned int step = 24;
+    double fps = 60.0;
+    unsigned long mismatches = 0;
+    double error = 0.0;
+    double worst = 0.0;
+    unsigned long samples = 0;
+    int option;
+
+    while ((option = getopt(argc, argv, "f:F:s:")) != -1)
+    {
+        switch (option)
+        {
+            case 'f': frames = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'F': fps = strtod(optarg, 0); break;
+            case 's': step = (unsigned int)strtoul(optarg, 0, 0); break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!frames || !step || (fps <= 0.0))
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    /* accuracy and equality of the line functions over a plane of the three dimensions */
+    for (unsigned long y=0; y < 0x4000; y += 0x53)
+    {
+        static signed int line[4096];
+        const unsigned long z = (y * 7) + 0x1234;
+
+        apa102_noise_line1(y * 11, step, line, 4096);
+        for (unsigned int i=0; i < 4096; i++)
+        {
+            const unsigned long x = (y * 11) + (i * step);
+            const double reference = bench_reference1(x / 256.0) * 4096.0;
+
+            mismatches += (line[i] != apa102_noise1(x));
+            error += fabs(line[i] - reference);
+            worst = fmax(worst, fabs(line[i] - reference));
+            samples++;
+        }
+
+        apa102_noise_line2(y * 3, y, step, line, 4096);
+        for (unsigned int i=0; i < 4096; i++)
+        {
+            const unsigned long x = (y * 3) + (i * step);
+            const double reference = bench_reference2(x / 256.0, y / 256.0) * 4096.0;
+
+            mismatches += (line[i] != apa102_noise2(x, y));
+            error += fabs(line[i] - reference);
+            worst = fmax(worst, fabs(line[i] - reference));
+            samples++;
+        }
+
+        apa102_noise_line3(y * 5, y, z, step, line, 4096);
+        for (unsigned int i=0; i < 4096; i++)
+        {
+            const unsigned long x = (y * 5) + (i * step);
+            const double reference = bench_reference3(x / 256.0, y / 256.0, z / 256.0) * 4096.0;
+
+            mismatches += (line[i] != apa102_noise3(x, y, z));
+            error += fabs(line[i] - reference);
+            worst = fmax(worst, fabs(line[i] - reference));
+            samples++;
+        }
+    }
+
+    printf("step %u/256 cell, %lu samples: line/point mismatches %lu, error vs float mean %.2f max %.0f (of 4096)\n", step, samples, mismatches, error / samples, worst);
+    printf("%u frames of 3d noise, budget %.0f us per frame (%.0f fps)\n", frames, 1e6 / fps, fps);
+    printf("%8s %12s %12s %12s %12s %10s\n", "leds", "float ns", "point ns", "line ns", "line us", "budget %");
+
+    for (unsigned int l=0; l < (sizeof(lengths) / sizeof(lengths[0])); l++)
+    {
+        const unsigned int leds = lengths[l];
+        signed int *values = malloc(leds * sizeof(signed int));
+        double *references = malloc(leds * sizeof(double));
+        double reference = 0.0;
+        double point = 0.0;
+        double line = 0.0;
+        volatile double sink = 0.0;
+
+        if (!values || !references)
+        {
+            fprintf(stderr, "%s: out of memory\n", argv[0]);
+            return 1;
+        }
+
+        for (unsigned int frame=0; frame < frames; frame++)
+        {
+            const unsigned long y = 0x2000;
+            const unsigned long z = frame * 8UL;
+            double start = bench_now();
+
+            for (unsigned int i=0; i < leds; i++)
+            {
+                references[i] = bench_reference3((i * step) / 256.0, y / 256.0, z / 256.0);
+            }
+            reference += bench_now() - start;
+            sink += references[frame % leds];
+
+            start = bench_now();
+            for (unsigned int i=0; i < leds; i++)
+            {
+                values[i] = apa102_noise3(i * step, y, z);
+            }
+            point += bench_now() - start;
+            sink += values[frame % leds];
+
+            start = bench_now();
+            apa102_noise_line3(0, y, z, step, values, leds);
+            line += bench_now() - start;
+            sink += values[frame % leds];
+        }
+
+        printf("%8u %12.1f %12.1f %12.1f %12.2f %9.2f%%\n", leds, (reference / frames / leds) * 1e9, (point / frames / leds) * 1e9, (line / frames / leds) * 1e9, (line / frames) * 1e6, ((line / frames) * fps) * 100.0);
+
+        free(references);
+        free(values);
+    }
+
+    return mismatches ? 1 : 0;
+}
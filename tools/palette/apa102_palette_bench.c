@@ -0,0 +1,140 @@
+/**
+ * @file apa102_palette_bench.c
+ * @brief Benchmark of gradient ramps against per-LED interpolation.
+ *
+ * This host tool maps a moving scalar field to colors with a gradient of several stops. It compares the interpolation of every LED at runtime (`apa102_palette_color()` and `apa102_encode()`) with a ramp that is compiled once and copied per LED (`apa102_palette_encode()`), in RGB and in Oklab, and prints the time per LED and the time to compile a ramp.
+ *
+ * @code
+ * apa102_palette_bench [-f frames] [-n leds]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../apa102_palette.h"
+
+unsigned char spi_transfer(unsigned char data)
+{
+    return data;
+}
+
+static double bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void bench_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-f frames] [-n leds]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    static const APA102_Palette_Stop heat[] =
+    {
+        { 0x00, { APA102_MAX_INTENSITY, 0x00, 0x00, 0x00 } },
+        { 0x55, { APA102_MAX_INTENSITY, 0xC0, 0x00, 0x00 } },
+        { 0xAA, { APA102_MAX_INTENSITY, 0xFF, 0xA0, 0x00 } },
+        { 0xFF, { APA102_MAX_INTENSITY, 0xFF, 0xFF, 0xE0 } }
+    };
+    static const char *spaces[] = { "rgb", "oklab" };
+    static APA102_Palette_Ramp ramp;
+    unsigned int frames = 500;
+    unsigned int leds = 10000;
+    int option;
+
+    while ((option = getopt(argc, argv, "f:n:")) != -1)
+    {
+        switch (option)
+        {
+            case 'f': frames = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'n': leds = (unsigned int)strtoul(optarg, 0, 0); break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!frames || !leds)
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    unsigned char *values = malloc(leds);
+    unsigned char *runtime = malloc(leds * APA102_LED_FRAME_SIZE);
+    unsigned char *lookup = malloc(leds * APA102_LED_FRAME_SIZE);
+
+    if (!values || !runtime || !lookup)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    }
+
+    printf("%u LEDs, %u frames, %u stops\n", leds, frames, (unsigned int)(sizeof(heat) / sizeof(heat[0])));
+    printf("%8s %14s %14s %14s %10s\n", "space", "runtime ns", "ramp ns", "compile us", "equal");
+
+    for (unsigned int space=APA102_Palette_RGB; space <= APA102_Palette_Oklab; space++)
+    {
+        double interpolate = 0.0;
+        double copy = 0.0;
+        double compile = bench_now();
+        int equal = 1;
+
+        apa102_palette_compile(&ramp, heat, sizeof(heat) / sizeof(heat[0]), (APA102_Palette_Space)space);
+        compile = bench_now() - compile;
+
+        for (unsigned int frame=0; frame < frames; frame++)
+        {
+            for (unsigned int i=0; i < leds; i++)
+            {
+                values[i] = (unsigned char)((i * 3) + (frame * 5));
+            }
+
+            double start = bench_now();
+
+            for (unsigned int i=0; i < leds; i++)
+            {
+                GFX_RGBA_Color color;
+
+                apa102_palette_color(heat, sizeof(heat) / sizeof(heat[0]), (APA102_Palette_Space)space, values[i], &color);
+                apa102_encode(i, APA102_START_FLAG | (0x3F & color.alpha), &color, &runtime[i * APA102_LED_FRAME_SIZE]);
+            }
+            interpolate += bench_now() - start;
+
+            start = bench_now();
+            apa102_palette_encode(&ramp, values, 0, leds, lookup);
+            copy += bench_now() - start;
+
+            equal &= !memcmp(runtime, lookup, leds * APA102_LED_FRAME_SIZE);
+        }
+
+        printf("%8s %14.2f %14.2f %14.2f %10s\n", spaces[space], (interpolate / frames / leds) * 1e9, (copy / frames / leds) * 1e9, compile * 1e6, equal ? "yes" : "no");
+    }
+
+    free(lookup);
+    free(runtime);
+    free(values);
+
+    return 0;
+}
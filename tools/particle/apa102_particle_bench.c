@@ -0,0 +1,144 @@
+/**
+ * @file apa102_particle_bench.c
+ * @brief Benchmark of the particle engine over particle and LED counts.
+ *
+ * This host tool keeps a number of particles alive on strips of different length and measures the time of a frame: simulation and rendering of the particles, and the complete frame including clearing the color buffer and encoding the LED frames. The time is compared with the frame budget of the target frame rate.
+ *
+ * @code
+ * apa102_particle_bench [-f frames] [-F fps]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../apa102_particle.h"
+
+unsigned char spi_transfer(unsigned char data)
+{
+    return data;
+}
+
+static double bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void bench_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-f frames] [-F fps]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    static const unsigned int particles[] = { 16, 64, 256, 1024, APA102_PARTICLE_POOL };
+    static const unsigned int lengths[] = { 60, 300, 1000, 10000 };
+    unsigned int frames = 2000;
+    double fps = 60.0;
+    int option;
+
+    while ((option = getopt(argc, argv, "f:F:")) != -1)
+    {
+        switch (option)
+        {
+            case 'f': frames = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'F': fps = strtod(optarg, 0); break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!frames || (fps <= 0.0))
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    printf("%u frames, budget %.0f us per frame (%.0f fps), pool %u\n", frames, 1e6 / fps, fps, (unsigned int)APA102_PARTICLE_POOL);
+    printf("%8s %10s %14s %14s %12s\n", "leds", "particles", "particles us", "frame us", "budget %");
+
+    for (unsigned int l=0; l < (sizeof(lengths) / sizeof(lengths[0])); l++)
+    {
+        unsigned int leds = lengths[l];
+        GFX_RGBA_Color *colors = malloc(leds * sizeof(GFX_RGBA_Color));
+        unsigned char *buffer = malloc(leds * APA102_LED_FRAME_SIZE);
+
+        if (!colors || !buffer)
+        {
+            fprintf(stderr, "%s: out of memory\n", argv[0]);
+            return 1;
+        }
+
+        for (unsigned int p=0; p < (sizeof(particles) / sizeof(particles[0])); p++)
+        {
+            unsigned int count = particles[p];
+            unsigned int seed = 1;
+            double simulate = 0.0;
+            double total = 0.0;
+
+            apa102_particle_clear();
+
+            for (unsigned int frame=0; frame < frames; frame++)
+            {
+                double start = bench_now();
+
+                /* refill the pool with bursts at random positions */
+                while (apa102_particle_count() < count)
+                {
+                    const GFX_RGBA_Color color = { 0, (unsigned char)seed, (unsigned char)(seed >> 8), 0xFF };
+
+                    seed = (seed * 1103515245U) + 12345U;
+
+                    unsigned char burst = (unsigned char)(((count - apa102_particle_count()) < 16) ? (count - apa102_particle_count()) : 16);
+
+                    apa102_particle_burst(APA102_PARTICLE_POSITION((seed >> 8) % leds), burst, 0x80, 120, &color);
+                }
+
+                memset(colors, 0, leds * sizeof(GFX_RGBA_Color));
+
+                double particle = bench_now();
+
+                apa102_particle_step(-2, 0xF8, leds);
+                apa102_particle_render(colors, leds);
+
+                particle = bench_now() - particle;
+
+                for (unsigned int i=0; i < leds; i++)
+                {
+                    colors[i].alpha = APA102_MAX_INTENSITY;
+                    apa102_encode(i, APA102_START_FLAG | APA102_MAX_INTENSITY, &colors[i], &buffer[i * APA102_LED_FRAME_SIZE]);
+                }
+
+                simulate += particle;
+                total += bench_now() - start;
+            }
+
+            printf("%8u %10u %14.2f %14.2f %11.2f%%\n", leds, count, (simulate / frames) * 1e6, (total / frames) * 1e6, ((total / frames) * fps) * 100.0);
+        }
+
+        free(buffer);
+        free(colors);
+    }
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file apa102_pipeline_bench.c
+ * @brief Benchmark of the fused pixel pipeline against separate passes.
+ *
+ * This host tool runs gamma, white balance, master dimmer and power limit over a color buffer in two ways: as separate passes over the buffer followed by `apa102_encode()` for every LED, and fused with `apa102_pipeline_encode()`. The time per frame and per LED is printed for every strip length. Afterwards a black frame followed by a white frame is encoded, the current of the white frame is computed from the LED frames and the tool exits with an error if it exceeds the budget.
+ *
+ * @code
+ * apa102_pipeline_bench [-f frames] [-b budget] [leds ...]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../apa102_pipeline.h"
+
+#define BENCH_WHITE_RED   0xFF
+#define BENCH_WHITE_GREEN 0xE0
+#define BENCH_WHITE_BLUE  0xC0
+#define BENCH_DIMMER      0xC0
+
+static unsigned char bench_gamma[256];
+static unsigned long bench_estimate;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    return data;
+}
+
+static double bench_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void bench_scale(GFX_RGBA_Color *colors, unsigned int leds, unsigned int red, unsigned int green, unsigned int blue)
+{
+    for (unsigned int i=0; i < leds; i++)
+    {
+        colors[i].red = (unsigned char)((colors[i].red * red) >> 8);
+        colors[i].green = (unsigned char)((colors[i].green * green) >> 8);
+        colors[i].blue = (unsigned char)((colors[i].blue * blue) >> 8);
+    }
+}
+
+static void bench_separate(const GFX_RGBA_Color *source, GFX_RGBA_Color *colors, unsigned int leds, unsigned int budget, unsigned char *frames)
+{
+    memcpy(colors, source, leds * sizeof(GFX_RGBA_Color));
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        colors[i].red = bench_gamma[colors[i].red];
+        colors[i].green = bench_gamma[colors[i].green];
+        colors[i].blue = bench_gamma[colors[i].blue];
+    }
+
+    bench_scale(colors, leds, BENCH_WHITE_RED + 1, BENCH_WHITE_GREEN + 1, BENCH_WHITE_BLUE + 1);
+    bench_scale(colors, leds, BENCH_DIMMER + 1, BENCH_DIMMER + 1, BENCH_DIMMER + 1);
+
+    unsigned long long load = 0;
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        load += (unsigned long long)(colors[i].red + colors[i].green + colors[i].blue) * (colors[i].alpha & APA102_MAX_INTENSITY);
+    }
+    bench_estimate = (unsigned long)((load * APA102_PIPELINE_CURRENT) / (255UL * APA102_MAX_INTENSITY));
+
+    if (budget && (bench_estimate > budget))
+    {
+        unsigned int scale = (unsigned int)(((unsigned long long)budget * 256ULL) / bench_estimate);
+
+        bench_scale(colors, leds, scale, scale, scale);
+    }
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        apa102_encode(i, APA102_START_FLAG | (0x3F & colors[i].alpha), &colors[i], &frames[i * APA102_LED_FRAME_SIZE]);
+    }
+}
+
+static void bench_fused(const GFX_RGBA_Color *source, unsigned int leds, unsigned char *frames)
+{
+    apa102_pipeline_measure(source, leds);
+    apa102_pipeline_begin();
+    apa102_pipeline_encode(source, 0, leds, frames);
+    apa102_pipeline_end();
+}
+
+static double bench_current(const unsigned char *frames, unsigned int leds)
+{
+    unsigned long long load = 0;
+
+    for (unsigned int i=0; i < leds; i++, frames += APA102_LED_FRAME_SIZE)
+    {
+        load += (unsigned long long)(frames[1] + frames[2] + frames[3]) * (frames[0] & APA102_MAX_INTENSITY);
+    }
+    return ((double)load * APA102_PIPELINE_CURRENT) / (255.0 * APA102_MAX_INTENSITY);
+}
+
+static int bench_check(GFX_RGBA_Color *colors, unsigned int leds, unsigned int budget, unsigned char *frames)
+{
+    for (unsigned int i=0; i < leds; i++)
+    {
+        colors[i] = (GFX_RGBA_Color){ APA102_MAX_INTENSITY, 0x00, 0x00, 0x00 };
+    }
+    bench_fused(colors, leds, frames);
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        colors[i] = (GFX_RGBA_Color){ APA102_MAX_INTENSITY, 0xFF, 0xFF, 0xFF };
+    }
+    bench_fused(colors, leds, frames);
+
+    double current = bench_current(frames, leds);
+    int failed = budget && (current > budget);
+
+    printf("%8s black -> white %.0f mA (estimate %lu mA): %s\n", "", current, apa102_pipeline_current(), failed ? "over budget" : "ok");
+
+    return failed;
+}
+
+static void bench_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-f frames] [-b budget] [leds ...]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    static const unsigned int lengths[] = { 1000, 10000 };
+    unsigned int frames = 1000;
+    unsigned int budget = 5000;
+    int option;
+    int failed = 0;
+
+    while ((option = getopt(argc, argv, "f:b:")) != -1)
+    {
+        switch (option)
+        {
+            case 'f': frames = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'b': budget = (unsigned int)strtoul(optarg, 0, 0); break;
+            default:
+                bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!frames)
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    for (unsigned int i=0; i < 256; i++)
+    {
+        bench_gamma[i] = (unsigned char)lround(255.0 * pow(i / 255.0, 2.2));
+    }
+
+    apa102_pipeline_white(BENCH_WHITE_RED, BENCH_WHITE_GREEN, BENCH_WHITE_BLUE);
+    apa102_pipeline_dimmer(BENCH_DIMMER);
+    apa102_pipeline_power(budget);
+
+    printf("%u frames, budget %u mA\n", frames, budget);
+    printf("%8s %16s %16s %12s %12s %8s\n", "leds", "separate us/frm", "fused us/frm", "separate ns", "fused ns", "speedup");
+
+    unsigned int count = (optind < argc) ? (unsigned int)(argc - optind) : (unsigned int)(sizeof(lengths) / sizeof(lengths[0]));
+
+    for (unsigned int n=0; n < count; n++)
+    {
+        unsigned int leds = (optind < argc) ? (unsigned int)strtoul(argv[optind + n], 0, 0) : lengths[n];
+        GFX_RGBA_Color *source = malloc(leds * sizeof(GFX_RGBA_Color));
+        GFX_RGBA_Color *colors = malloc(leds * sizeof(GFX_RGBA_Color));
+        unsigned char *buffer = malloc(leds * APA102_LED_FRAME_SIZE);
+
+        if (!leds || !source || !colors || !buffer)
+        {
+            fprintf(stderr, "%s: invalid number of LEDs %u\n", argv[0], leds);
+            return 1;
+        }
+
+        for (unsigned int i=0; i < leds; i++)
+        {
+            source[i] = (GFX_RGBA_Color){ 0x1F, (unsigned char)(i * 7), (unsigned char)(i * 13), (unsigned char)(i * 29) };
+        }
+
+        double start = bench_now();
+
+        for (unsigned int frame=0; frame < frames; frame++)
+        {
+            bench_separate(source, colors, leds, budget, buffer);
+        }
+
+        double separate = (bench_now() - start) / frames;
+
+        start = bench_now();
+
+        for (unsigned int frame=0; frame < frames; frame++)
+        {
+            bench_fused(source, leds, buffer);
+        }
+
+        double fused = (bench_now() - start) / frames;
+
+        printf("%8u %16.2f %16.2f %12.2f %12.2f %7.2fx\n", leds, separate * 1e6, fused * 1e6, (separate * 1e9) / leds, (fused * 1e9) / leds, separate / fused);
+        printf("%8s estimate %lu mA (separate), %lu mA (fused)\n", "", bench_estimate, apa102_pipeline_current());
+
+        failed |= bench_check(colors, leds, budget, buffer);
+
+        free(buffer);
+        free(colors);
+        free(source);
+    }
+
+    return failed;
+}
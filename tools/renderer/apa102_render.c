@@ -0,0 +1,382 @@
+/**
+ * @file apa102_render.c
+ * @brief Host tool rendering the emulated LED chain to the terminal or to image files.
+ *
+ * This host tool feeds a capture of the frame recorder into the chain emulator and renders the LED states of every completed frame. The output is either a truecolour terminal view (strip or matrix, two LED rows per character cell) or a sequence of binary PPM images. Colors are scaled with the 5-bit intensity (brightness field) of every LED like a real APA102 does.
+ *
+ * @code
+ * apa102_render -n leds [-w width] [-s] [-r] [-f apa102|hd108] [-o prefix] [-x scale] [-F fps] [-p] [-b] capture.bin
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../emulator/apa102_capture.h"
+
+#define RENDER_CHUNK 65536
+
+typedef struct
+{
+    unsigned int leds;
+    unsigned int width;
+    unsigned int height;
+    int serpentine;
+    unsigned int scale;
+    const char *prefix;
+    double fps;
+    int pace;
+    int benchmark;
+
+    unsigned char intensity[32][256];
+    unsigned int *position;
+    unsigned char *image;
+    char *terminal;
+    char decimal[256][4];
+
+    unsigned long long start;
+    unsigned long long clock;
+    unsigned long long shown;
+    unsigned long long record_start;
+    unsigned long frames;
+    unsigned long written;
+} Render_Context;
+
+static unsigned long long render_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((unsigned long long)now.tv_sec * 1000000000ULL) + (unsigned long long)now.tv_nsec;
+}
+
+static void render_sleep(unsigned long long nanoseconds)
+{
+    struct timespec delay = { (time_t)(nanoseconds / 1000000000ULL), (long)(nanoseconds % 1000000000ULL) };
+
+    nanosleep(&delay, 0);
+}
+
+static void render_image(Render_Context *context, const APA102_Emulator *emulator)
+{
+    const int wide = (emulator->format == APA102_Emulator_HD108);
+
+    for (unsigned int i=0; i < context->leds; i++)
+    {
+        const APA102_Emulator_LED *led = &emulator->leds[i];
+        unsigned char *pixel = &context->image[context->position[i]];
+
+        // The 5-bit intensity scales the output current of every channel (value * intensity / 31)
+        if (wide)
+        {
+            pixel[0] = context->intensity[led->gain[0]][led->red >> 8];
+            pixel[1] = context->intensity[led->gain[1]][led->green >> 8];
+            pixel[2] = context->intensity[led->gain[2]][led->blue >> 8];
+        }
+        else
+        {
+            pixel[0] = context->intensity[led->gain[0]][led->red];
+            pixel[1] = context->intensity[led->gain[0]][led->green];
+            pixel[2] = context->intensity[led->gain[0]][led->blue];
+        }
+    }
+}
+
+static char *render_color(char *output, const char *prefix, const char (*decimal)[4], const unsigned char *pixel)
+{
+    while (*prefix)
+    {
+        *output++ = *prefix++;
+    }
+    for (unsigned int channel=0; channel < 3; channel++)
+    {
+        const char *digits = decimal[pixel[channel]];
+
+        while (*digits)
+        {
+            *output++ = *digits++;
+        }
+        *output++ = (channel < 2) ? ';' : 'm';
+    }
+    return output;
+}
+
+static void render_terminal(Render_Context *context)
+{
+    static const unsigned char black[3] = { 0, 0, 0 };
+    char *output = context->terminal;
+
+    memcpy(output, "\x1b[H", 3);
+    output += 3;
+
+    // Every character cell shows two LED rows, the upper one as foreground of a half block
+    for (unsigned int y=0; y < context->height; y += 2)
+    {
+        for (unsigned int x=0; x < context->width; x++)
+        {
+            const unsigned char *upper = &context->image[(y * context->width + x) * 3];
+            const unsigned char *lower = (y + 1 < context->height) ? &context->image[((y + 1) * context->width + x) * 3] : black;
+
+            output = render_color(output, "\x1b[38;2;", (const char (*)[4])context->decimal, upper);
+            output = render_color(output, "\x1b[48;2;", (const char (*)[4])context->decimal, lower);
+            memcpy(output, "\xe2\x96\x80", 3);
+            output += 3;
+        }
+        memcpy(output, "\x1b[0m\n", 5);
+        output += 5;
+    }
+
+    fwrite(context->terminal, 1, (size_t)(output - context->terminal), stdout);
+    fflush(stdout);
+}
+
+static void render_ppm(Render_Context *context)
+{
+    char path[4096];
+    FILE *file;
+
+    snprintf(path, sizeof(path), "%s%06lu.ppm", context->prefix, context->written++);
+    file = fopen(path, "wb");
+
+    if (!file)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    fprintf(file, "P6\n%u %u\n255\n", context->width * context->scale, context->height * context->scale);
+
+    for (unsigned int y=0; y < context->height * context->scale; y++)
+    {
+        const unsigned char *row = &context->image[(y / context->scale) * context->width * 3];
+
+        for (unsigned int x=0; x < context->width * context->scale; x++)
+        {
+            fwrite(&row[(x / context->scale) * 3], 1, 3, file);
+        }
+    }
+    fclose(file);
+}
+
+static void render_frame(const APA102_Emulator *emulator, const APA102_Emulator_Frame *frame, void *user)
+{
+    Render_Context *context = user;
+    unsigned long long now;
+
+    (void)frame;
+
+    context->frames++;
+    render_image(context, emulator);
+
+    if (context->benchmark)
+    {
+        return;
+    }
+    if (context->prefix)
+    {
+        render_ppm(context);
+        return;
+    }
+
+    now = render_now();
+
+    if (context->pace && context->record_start)
+    {
+        // Replay the frames with the timing of the capture
+        if (!context->clock)
+        {
+            context->clock = context->record_start;
+            context->start = now;
+        }
+
+        unsigned long long due = context->start + (context->record_start - context->clock);
+
+        if (due > now)
+        {
+            render_sleep(due - now);
+            now = due;
+        }
+    }
+
+    if (context->fps > 0.0 && context->shown && (double)(now - context->shown) < 1e9 / context->fps)
+    {
+        return;
+    }
+    context->shown = now;
+    render_terminal(context);
+}
+
+static void render_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s -n leds [-w width] [-s] [-r] [-f apa102|hd108] [-o prefix] [-x scale] [-F fps] [-p] [-b] capture\n", name);
+    fprintf(stderr, "  -n leds    number of LEDs in the chain\n");
+    fprintf(stderr, "  -w width   LEDs per row of a matrix (default all LEDs in one row)\n");
+    fprintf(stderr, "  -s         serpentine matrix (every second row reversed)\n");
+    fprintf(stderr, "  -r         input is a raw ring buffer dump without file header\n");
+    fprintf(stderr, "  -f format  frame format of raw dumps (default apa102)\n");
+    fprintf(stderr, "  -o prefix  write every frame as PPM image <prefix>NNNNNN.ppm\n");
+    fprintf(stderr, "  -x scale   pixels per LED in PPM images (default 8)\n");
+    fprintf(stderr, "  -F fps     limit the terminal refresh rate (default 60, 0 shows every frame)\n");
+    fprintf(stderr, "  -p         replay with the timing of the capture\n");
+    fprintf(stderr, "  -b         benchmark, render without output and print the frame rate\n");
+}
+
+int main(int argc, char *argv[])
+{
+    APA102_Emulator_Format format = APA102_Emulator_APA102;
+    Render_Context *context = calloc(1, sizeof(Render_Context));
+    int raw = 0;
+    int option;
+
+    if (!context)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    context->scale = 8;
+    context->fps = 60.0;
+
+    while ((option = getopt(argc, argv, "n:w:srf:o:x:F:pbh")) != -1)
+    {
+        switch (option)
+        {
+            case 'n': context->leds = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'w': context->width = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 's': context->serpentine = 1; break;
+            case 'r': raw = 1; break;
+            case 'f': format = strcmp(optarg, "hd108") ? APA102_Emulator_APA102 : APA102_Emulator_HD108; break;
+            case 'o': context->prefix = optarg; break;
+            case 'x': context->scale = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'F': context->fps = strtod(optarg, 0); break;
+            case 'p': context->pace = 1; break;
+            case 'b': context->benchmark = 1; break;
+            default:
+                render_usage(argv[0]);
+                free(context);
+                return option == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (optind != argc - 1 || !context->leds || !context->scale)
+    {
+        render_usage(argv[0]);
+        free(context);
+        return EXIT_FAILURE;
+    }
+    if (!context->width || context->width > context->leds)
+    {
+        context->width = context->leds;
+    }
+    context->height = (context->leds + context->width - 1) / context->width;
+
+    for (unsigned int intensity=0; intensity < 32; intensity++)
+    {
+        for (unsigned int value=0; value < 256; value++)
+        {
+            context->intensity[intensity][value] = (unsigned char)((value * intensity + 15) / 31);
+        }
+    }
+    for (unsigned int value=0; value < 256; value++)
+    {
+        snprintf(context->decimal[value], sizeof(context->decimal[value]), "%u", value);
+    }
+
+    context->position = malloc(context->leds * sizeof(unsigned int));
+    context->image = calloc((size_t)context->width * context->height, 3);
+    context->terminal = malloc((size_t)context->width * ((context->height + 1) / 2) * 48 + (context->height * 8) + 16);
+
+    unsigned char *buffer = malloc(RENDER_CHUNK);
+
+    if (!context->position || !context->image || !context->terminal || !buffer)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        free(buffer);
+        free(context->position);
+        free(context->image);
+        free(context->terminal);
+        free(context);
+        return EXIT_FAILURE;
+    }
+
+    for (unsigned int i=0; i < context->leds; i++)
+    {
+        unsigned int y = i / context->width;
+        unsigned int x = i % context->width;
+
+        if (context->serpentine && (y & 0x01))
+        {
+            x = context->width - 1 - x;
+        }
+        context->position[i] = (y * context->width + x) * 3;
+    }
+
+    APA102_Capture capture;
+    APA102_Capture_Record record;
+    APA102_Emulator emulator;
+    unsigned long length;
+
+    if (apa102_capture_open(&capture, argv[optind], raw, format))
+    {
+        fprintf(stderr, "%s: cannot open capture (use -r for raw dumps)\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+    if (apa102_emulator_init(&emulator, capture.format, context->leds, render_frame, context))
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    if (!context->prefix && !context->benchmark)
+    {
+        fputs("\x1b[2J", stdout);
+    }
+
+    unsigned long long begin = render_now();
+
+    while (apa102_capture_next(&capture, &record))
+    {
+        context->record_start = record.start;
+
+        while ((length = apa102_capture_read(&capture, buffer, RENDER_CHUNK)) > 0)
+        {
+            apa102_emulator_feed(&emulator, buffer, length);
+        }
+    }
+    apa102_emulator_flush(&emulator);
+
+    if (!context->prefix && !context->benchmark && context->frames)
+    {
+        render_terminal(context);
+    }
+
+    double elapsed = (double)(render_now() - begin) / 1e9;
+
+    fprintf(stderr, "%lu frames, %u LEDs, %.3fs, %.1f fps\n", context->frames, context->leds, elapsed, elapsed > 0.0 ? context->frames / elapsed : 0.0);
+
+    apa102_capture_close(&capture);
+    apa102_emulator_free(&emulator);
+    free(buffer);
+    free(context->position);
+    free(context->image);
+    free(context->terminal);
+    free(context);
+
+    return EXIT_SUCCESS;
+}
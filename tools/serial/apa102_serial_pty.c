@@ -0,0 +1,582 @@
+/**
+ * @file apa102_serial_pty.c
+ * @brief Pseudo-terminal stand-in for the UART of the serial receiver.
+ *
+ * This host tool opens a pseudo-terminal and prints the path of its serial side, which is given to ambilight software (or any Adalight/TPM2 sender) instead of a USB serial adapter. Every byte written to it is passed to `apa102_serial_receive()` like in the receive interrupt of the USART, and the SPI bytes of the driver are fed into the LED chain emulator. For every latched frame the tool prints the number of LEDs, the first and last color, the protocol violations and the time from the first received byte to the latch.
+ *
+ * With `-T` the tool checks itself: it writes a full Adalight frame, a short TPM2 data packet, an Adalight header with a wrong checksum followed by a valid frame, a truncated frame ended by the timeout, a TPM2 command packet and a short frame directly followed by the next header into the serial side, compares the LEDs of the emulator and the counters of the receiver after every step and exits with a non-zero status on the first mismatch.
+ *
+ * @code
+ * apa102_serial_pty [-n leds] [-i intensity] [-t timeout_ms] [-a hello_ms] [-l link] [-q] [-T]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#define _XOPEN_SOURCE 700
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../apa102_serial.h"
+#include "../emulator/apa102_emulator.h"
+
+typedef struct
+{
+    int quiet;
+    double first;
+    double received;
+    unsigned long frames;
+    unsigned long violations;
+    double latency_sum;
+    double latency_max;
+} Serial_Context;
+
+static APA102_Emulator serial_emulator;
+static volatile sig_atomic_t serial_stop;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    apa102_emulator_feed(&serial_emulator, &data, 1);
+    return data;
+}
+
+static double serial_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static void serial_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-n leds] [-i intensity] [-t timeout_ms] [-a hello_ms] [-l link] [-q] [-T]\n", name);
+}
+
+static void serial_signal(int number)
+{
+    (void)number;
+    serial_stop = 1;
+}
+
+static void serial_frame(const APA102_Emulator *emulator, const APA102_Emulator_Frame *frame, void *user)
+{
+    Serial_Context *context = user;
+    double latency = (serial_now() - context->first) * 1e6;
+    const APA102_Emulator_LED *first = &emulator->leds[0];
+    const APA102_Emulator_LED *last = &emulator->leds[frame->leds ? (frame->leds - 1) : 0];
+
+    context->frames++;
+    context->latency_sum += latency;
+
+    if (latency > context->latency_max)
+    {
+        context->latency_max = latency;
+    }
+    if (frame->violations)
+    {
+        context->violations++;
+    }
+
+    if (!context->quiet)
+    {
+        printf("frame %lu: %u leds, first #%02X%02X%02X, last #%02X%02X%02X, %.0f us, violations 0x%02X\n",
+               frame->sequence, frame->leds,
+               first->red, first->green, first->blue,
+               last->red, last->green, last->blue,
+               latency, frame->violations);
+        fflush(stdout);
+    }
+}
+
+static int serial_raw(int descriptor)
+{
+    struct termios mode;
+
+    if (tcgetattr(descriptor, &mode))
+    {
+        return -1;
+    }
+
+    mode.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+    mode.c_oflag &= ~OPOST;
+    mode.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    mode.c_cflag &= ~(CSIZE | PARENB);
+    mode.c_cflag |= CS8;
+    mode.c_cc[VMIN] = 1;
+    mode.c_cc[VTIME] = 0;
+
+    return tcsetattr(descriptor, TCSANOW, &mode);
+}
+
+static int serial_pump(int master, unsigned int timeout, int wait, Serial_Context *context)
+{
+    static unsigned char buffer[4096];
+    struct pollfd descriptor = { master, POLLIN, 0 };
+    ssize_t length;
+
+    if (poll(&descriptor, 1, wait) < 0)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+        perror("poll");
+        return -1;
+    }
+
+    if (!(descriptor.revents & POLLIN))
+    {
+        if (timeout && apa102_serial_status() != APA102_Serial_Idle && (serial_now() - context->received) * 1e3 >= timeout)
+        {
+            apa102_serial_reset();
+        }
+        apa102_serial_update();
+        return 0;
+    }
+
+    length = read(master, buffer, sizeof(buffer));
+
+    if (length <= 0)
+    {
+        if (length < 0 && (errno == EAGAIN || errno == EINTR))
+        {
+            return 0;
+        }
+        return -1;
+    }
+    context->received = serial_now();
+
+    for (ssize_t i=0; i < length; i++)
+    {
+        if (apa102_serial_status() == APA102_Serial_Idle)
+        {
+            context->first = context->received;
+        }
+        apa102_serial_receive(buffer[i]);
+
+        // The main loop of a microcontroller runs between two received bytes
+        apa102_serial_update();
+    }
+    return 0;
+}
+
+#if APA102_FRAME_FORMAT == APA102_FORMAT_HD108
+    #define SERIAL_TEST_VALUE(value) ((unsigned int)(value) * 257U)
+#else
+    #define SERIAL_TEST_VALUE(value) ((unsigned int)(value))
+#endif
+
+typedef struct
+{
+    int master;
+    int slave;
+    unsigned int leds;
+    unsigned int intensity;
+    unsigned int timeout;
+    unsigned char colors[APA102_NUMBER_OF_LEDS][3];
+    unsigned char packet[2 * (6 + (3 * APA102_NUMBER_OF_LEDS) + 8)];
+    unsigned int length;
+} Serial_Test;
+
+static void serial_test_put(Serial_Test *test, unsigned char data)
+{
+    // A step holds at most a short frame and a full frame
+    if (test->length < sizeof(test->packet))
+    {
+        test->packet[test->length++] = data;
+    }
+}
+
+static void serial_test_pixels(Serial_Test *test, unsigned int count, unsigned int step)
+{
+    // LEDs that are missing in a frame are switched off by the receiver
+    memset(test->colors, 0, sizeof(test->colors));
+
+    for (unsigned int i=0; i < count; i++)
+    {
+        test->colors[i][0] = (unsigned char)((i * 7U) + (step * 50U));
+        test->colors[i][1] = (unsigned char)((i * 13U) + step);
+        test->colors[i][2] = (unsigned char)(0xFF - (i * 3U) - step);
+
+        for (unsigned int c=0; c < 3; c++)
+        {
+            serial_test_put(test, test->colors[i][c]);
+        }
+    }
+}
+
+static void serial_test_adalight(Serial_Test *test, unsigned int count, unsigned char checksum)
+{
+    unsigned char high = (unsigned char)((count - 1) >> 8);
+    unsigned char low = (unsigned char)(count - 1);
+
+    serial_test_put(test, 'A');
+    serial_test_put(test, 'd');
+    serial_test_put(test, 'a');
+    serial_test_put(test, high);
+    serial_test_put(test, low);
+    serial_test_put(test, (unsigned char)(high ^ low ^ 0x55 ^ checksum));
+}
+
+static void serial_test_tpm2(Serial_Test *test, unsigned char type, unsigned int length)
+{
+    serial_test_put(test, 0xC9);
+    serial_test_put(test, type);
+    serial_test_put(test, (unsigned char)(length >> 8));
+    serial_test_put(test, (unsigned char)length);
+}
+
+static int serial_test_send(Serial_Test *test, Serial_Context *context)
+{
+    unsigned int sent = 0;
+    double written;
+
+    // The serial side is not read by this process, so it is written in portions while the receiver runs
+    while (sent < test->length)
+    {
+        ssize_t length = write(test->slave, test->packet + sent, test->length - sent);
+
+        if (length < 0 && errno != EAGAIN && errno != EINTR)
+        {
+            perror("write");
+            return -1;
+        }
+        sent += (length > 0) ? (unsigned int)length : 0U;
+
+        if (serial_pump(test->master, test->timeout, 0, context))
+        {
+            return -1;
+        }
+    }
+    test->length = 0;
+    written = serial_now();
+
+    // Receive everything and give the timeout a chance to end a truncated frame
+    while ((serial_now() - ((context->received > written) ? context->received : written)) * 1e3 < (2.0 * test->timeout) + 20.0)
+    {
+        if (serial_pump(test->master, test->timeout, 10, context))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int serial_test_check(const Serial_Test *test, const char *step, const Serial_Context *context, unsigned long frames, unsigned long violations, const APA102_Serial_Statistics *expected)
+{
+    APA102_Serial_Statistics statistics;
+
+    apa102_serial_statistics(&statistics);
+
+    if (context->frames != frames || context->violations != violations)
+    {
+        fprintf(stderr, "%s: %lu frames latched (%lu with violations) instead of %lu (%lu)\n", step, context->frames, context->violations, frames, violations);
+        return 1;
+    }
+
+    if (statistics.adalight != expected->adalight || statistics.tpm2 != expected->tpm2 || statistics.checksum != expected->checksum ||
+        statistics.framing != expected->framing || statistics.aborted != expected->aborted)
+    {
+        fprintf(stderr, "%s: adalight %u, tpm2 %u, checksum errors %u, framing errors %u, aborted %u instead of %u, %u, %u, %u, %u\n", step,
+                statistics.adalight, statistics.tpm2, statistics.checksum, statistics.framing, statistics.aborted,
+                expected->adalight, expected->tpm2, expected->checksum, expected->framing, expected->aborted);
+        return 1;
+    }
+
+    for (unsigned int i=0; i < test->leds; i++)
+    {
+        const APA102_Emulator_LED *led = &serial_emulator.leds[i];
+
+        if (led->red != SERIAL_TEST_VALUE(test->colors[i][0]) || led->green != SERIAL_TEST_VALUE(test->colors[i][1]) || led->blue != SERIAL_TEST_VALUE(test->colors[i][2]) ||
+            led->gain[0] != test->intensity || led->gain[1] != test->intensity || led->gain[2] != test->intensity)
+        {
+            fprintf(stderr, "%s: LED %u is #%02X%02X%02X (intensity %u) instead of #%02X%02X%02X (intensity %u)\n", step, i,
+                    led->red, led->green, led->blue, led->gain[0],
+                    test->colors[i][0], test->colors[i][1], test->colors[i][2], test->intensity);
+            return 1;
+        }
+    }
+
+    if (!context->quiet)
+    {
+        printf("%s: ok\n", step);
+        fflush(stdout);
+    }
+    return 0;
+}
+
+static int serial_test(Serial_Test *test, Serial_Context *context)
+{
+    APA102_Serial_Statistics expected = { 0 };
+    unsigned int count = (test->leds < 4) ? test->leds : 4;
+
+    if (!test->timeout)
+    {
+        fprintf(stderr, "the self-test needs a timeout\n");
+        return 1;
+    }
+    fcntl(test->slave, F_SETFL, fcntl(test->slave, F_GETFL) | O_NONBLOCK);
+
+    // Full Adalight frame over the whole chain
+    serial_test_adalight(test, test->leds, 0x00);
+    serial_test_pixels(test, test->leds, 1);
+    expected.adalight++;
+
+    if (serial_test_send(test, context) || serial_test_check(test, "adalight frame", context, 1, 0, &expected))
+    {
+        return 1;
+    }
+
+    // Short TPM2 data packet, the remaining LEDs are switched off
+    serial_test_tpm2(test, 0xDA, 3 * count);
+    serial_test_pixels(test, count, 2);
+    serial_test_put(test, 0x36);
+    expected.tpm2++;
+
+    if (serial_test_send(test, context) || serial_test_check(test, "tpm2 data packet", context, 2, 0, &expected))
+    {
+        return 1;
+    }
+
+    // Header with a wrong checksum, the receiver resynchronizes on the next header
+    serial_test_adalight(test, count, 0x01);
+    serial_test_adalight(test, count, 0x00);
+    serial_test_pixels(test, count, 3);
+    expected.checksum++;
+    expected.adalight++;
+
+    if (serial_test_send(test, context) || serial_test_check(test, "checksum resync", context, 3, 0, &expected))
+    {
+        return 1;
+    }
+
+    // Truncated frame: the LEDs received so far are latched when the timeout aborts the frame
+    serial_test_adalight(test, count + 1, 0x00);
+    serial_test_pixels(test, count - 1, 4);
+    serial_test_put(test, 0x42);
+    expected.aborted++;
+
+    if (serial_test_send(test, context) || serial_test_check(test, "truncated frame", context, 4, 0, &expected))
+    {
+        return 1;
+    }
+
+    // TPM2 command packet, the LEDs are not changed
+    serial_test_tpm2(test, 0xC0, 3);
+    serial_test_put(test, 0x0A);
+    serial_test_put(test, 0x0B);
+    serial_test_put(test, 0x0C);
+    serial_test_put(test, 0x36);
+
+    if (serial_test_send(test, context) || serial_test_check(test, "tpm2 command packet", context, 4, 0, &expected) ||
+        apa102_serial_status() != APA102_Serial_Idle)
+    {
+        return 1;
+    }
+
+    // Short frame directly followed by the next header: the end byte and the header arrive while the short frame is completed
+    serial_test_tpm2(test, 0xDA, 3 * count);
+    serial_test_pixels(test, count, 5);
+    serial_test_put(test, 0x36);
+    serial_test_adalight(test, test->leds, 0x00);
+    serial_test_pixels(test, test->leds, 6);
+    expected.tpm2++;
+    expected.adalight++;
+
+    if (serial_test_send(test, context) || serial_test_check(test, "back-to-back frames", context, 6, 0, &expected))
+    {
+        return 1;
+    }
+
+    // Same bytes without the main loop in between: the next frame starts before the short frame was completed, its end frame is dropped
+    serial_test_tpm2(test, 0xDA, 3 * count);
+    serial_test_pixels(test, count, 7);
+    serial_test_put(test, 0x36);
+    serial_test_adalight(test, test->leds, 0x00);
+    serial_test_pixels(test, test->leds, 8);
+    expected.tpm2++;
+    expected.adalight++;
+
+    for (unsigned int i=0; i < test->length; i++)
+    {
+        apa102_serial_receive(test->packet[i]);
+    }
+    test->length = 0;
+    apa102_serial_update();
+
+    // The emulator reports the missing end frame of the short frame
+    if (serial_test_check(test, "dropped end frame", context, 8, 1, &expected))
+    {
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Serial_Context context = { 0 };
+    struct sigaction action;
+    APA102_Serial_Statistics statistics;
+    static Serial_Test test;
+    unsigned int leds = APA102_NUMBER_OF_LEDS;
+    unsigned int intensity = APA102_MAX_INTENSITY;
+    unsigned int timeout = 50;
+    unsigned int hello = 1000;
+    const char *link = 0;
+    const char *path;
+    double greeted = 0.0;
+    int master;
+    int slave;
+    int check = 0;
+    int option;
+
+    while ((option = getopt(argc, argv, "n:i:t:a:l:qT")) != -1)
+    {
+        switch (option)
+        {
+            case 'n': leds = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'i': intensity = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 't': timeout = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'a': hello = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'l': link = optarg; break;
+            case 'q': context.quiet = 1; break;
+            case 'T': check = 1; break;
+            default:
+                serial_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!leds || leds > APA102_NUMBER_OF_LEDS || intensity > APA102_MAX_INTENSITY || (check && leds < 2))
+    {
+        fprintf(stderr, "leds must be 1..%u (at least 2 for the self-test) and intensity 0..%u\n", (unsigned int)APA102_NUMBER_OF_LEDS, (unsigned int)APA102_MAX_INTENSITY);
+        serial_usage(argv[0]);
+        return 1;
+    }
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (master < 0 || grantpt(master) || unlockpt(master) || !(path = ptsname(master)))
+    {
+        perror("posix_openpt");
+        return 1;
+    }
+
+    // Keep the serial side open, so the pseudo-terminal survives senders that reconnect
+    slave = open(path, O_RDWR | O_NOCTTY);
+
+    if (slave < 0 || serial_raw(slave) || serial_raw(master))
+    {
+        perror(path);
+        return 1;
+    }
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    if (link)
+    {
+        unlink(link);
+
+        if (symlink(path, link))
+        {
+            perror(link);
+            return 1;
+        }
+        path = link;
+    }
+
+    if (apa102_emulator_init(&serial_emulator, (APA102_Emulator_Format)APA102_FRAME_FORMAT, leds, serial_frame, &context))
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = serial_signal;
+    sigaction(SIGINT, &action, 0);
+    sigaction(SIGTERM, &action, 0);
+
+    apa102_serial_init((unsigned char)intensity);
+
+    if (check)
+    {
+        test = (Serial_Test){ .master = master, .slave = slave, .leds = leds, .intensity = intensity, .timeout = timeout };
+
+        int failed = serial_test(&test, &context);
+
+        if (!failed)
+        {
+            printf("self-test passed: %lu frames latched\n", context.frames);
+        }
+
+        if (link)
+        {
+            unlink(link);
+        }
+        apa102_emulator_free(&serial_emulator);
+        close(slave);
+        close(master);
+
+        return failed;
+    }
+
+    printf("%s\n", path);
+    fflush(stdout);
+
+    while (!serial_stop)
+    {
+        double now = serial_now();
+
+        // Adalight senders wait for the greeting while the device is idle
+        if (hello && apa102_serial_status() == APA102_Serial_Idle && (now - greeted) * 1e3 >= hello)
+        {
+            if (write(master, APA102_SERIAL_HELLO, sizeof(APA102_SERIAL_HELLO) - 1) < 0 && errno != EAGAIN)
+            {
+                perror("write");
+                break;
+            }
+            greeted = now;
+        }
+
+        if (serial_pump(master, timeout, 10, &context))
+        {
+            break;
+        }
+    }
+
+    apa102_serial_statistics(&statistics);
+    fprintf(stderr, "adalight %u, tpm2 %u, checksum errors %u, framing errors %u, aborted %u\n",
+            statistics.adalight, statistics.tpm2, statistics.checksum, statistics.framing, statistics.aborted);
+    fprintf(stderr, "latched %lu frames, %lu with violations, latency %.0f us (max %.0f us)\n",
+            context.frames, context.violations,
+            context.frames ? (context.latency_sum / context.frames) : 0.0, context.latency_max);
+
+    if (link)
+    {
+        unlink(link);
+    }
+    apa102_emulator_free(&serial_emulator);
+    close(slave);
+    close(master);
+
+    return 0;
+}
@@ -0,0 +1,380 @@
+/**
+ * @file apa102_shm.c
+ * @brief Implementation of the shared-memory frame source (Linux).
+ *
+ * This source file creates and maps the shared-memory segment and implements the producer side of the frame slots. A slot is written like a sequence lock: the sequence is made odd, the LED data is written, the sequence is made even again and the head of the ring is advanced. The futex doorbell is shared between processes (no `FUTEX_PRIVATE_FLAG`).
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include "apa102_shm.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define APA102_SHM_ALIGN(size) (((size) + 63UL) & ~63UL)
+
+static unsigned long apa102_shm_unit(void)
+{
+    return (APA102_LED_FRAME_SIZE > sizeof(GFX_RGBA_Color)) ? APA102_LED_FRAME_SIZE : sizeof(GFX_RGBA_Color);
+}
+
+static int apa102_shm_map(APA102_Shm *shm, int descriptor, unsigned long size)
+{
+    void *address = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+
+    close(descriptor);
+
+    if (address == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    shm->header = address;
+    shm->size = size;
+    shm->leds = 0;
+    shm->slot_size = 0;
+    shm->slots_offset = 0;
+    shm->producer = -1;
+    shm->slot = 0;
+
+    return 0;
+}
+
+static int apa102_shm_stale(const char *name)
+{
+    struct stat status;
+    int32_t daemon = 0;
+    int descriptor = shm_open(name, O_RDONLY, 0);
+
+    if (descriptor < 0)
+    {
+        return errno == ENOENT;
+    }
+
+    if (!fstat(descriptor, &status) && ((unsigned long)status.st_size >= sizeof(APA102_Shm_Header)))
+    {
+        APA102_Shm_Header *header = mmap(0, sizeof(APA102_Shm_Header), PROT_READ, MAP_SHARED, descriptor, 0);
+
+        if (header != MAP_FAILED)
+        {
+            if (header->magic == APA102_SHM_MAGIC)
+            {
+                daemon = atomic_load_explicit(&header->daemon, memory_order_acquire);
+            }
+            munmap(header, sizeof(APA102_Shm_Header));
+        }
+    }
+    close(descriptor);
+
+    // Only a segment whose daemon no longer exists is left over, everything else belongs to someone
+    return (daemon > 0) && kill((pid_t)daemon, 0) && (errno == ESRCH);
+}
+
+/**
+ * @brief Create the shared-memory segment (daemon).
+ *
+ * @param shm Pointer to the mapping.
+ * @param name Name of the segment (e.g. `APA102_SHM_NAME`).
+ * @param leds Number of LEDs of the strip.
+ *
+ * @return `0` on success, `-1` if the segment could not be created (`errno` is set, `EEXIST` if it is used by a running daemon or not an APA102 segment).
+ *
+ * @details
+ * A segment left behind by a daemon that did not exit cleanly (its process no longer exists) is replaced, any other existing segment is kept. Every slot can hold all LEDs of the strip in both formats.
+ */
+int apa102_shm_create(APA102_Shm *shm, const char *name, unsigned int leds)
+{
+    unsigned long slot_size = APA102_SHM_ALIGN(sizeof(APA102_Shm_Slot) + (leds * apa102_shm_unit()));
+    unsigned long slots_offset = APA102_SHM_ALIGN(sizeof(APA102_Shm_Header));
+    unsigned long size = slots_offset + (APA102_SHM_PRODUCERS * APA102_SHM_SLOTS * slot_size);
+    int descriptor;
+
+    descriptor = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0666);
+
+    if ((descriptor < 0) && (errno == EEXIST))
+    {
+        if (!apa102_shm_stale(name))
+        {
+            errno = EEXIST;
+            return -1;
+        }
+        shm_unlink(name);
+        descriptor = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0666);
+    }
+
+    if (descriptor < 0)
+    {
+        return -1;
+    }
+
+    // The permissions of shm_open() are reduced by the umask, producers of other users need write access
+    fchmod(descriptor, 0666);
+
+    if (ftruncate(descriptor, (off_t)size) || apa102_shm_map(shm, descriptor, size))
+    {
+        shm_unlink(name);
+        return -1;
+    }
+
+    shm->header->magic = APA102_SHM_MAGIC;
+    shm->header->version = APA102_SHM_VERSION;
+    shm->header->leds = leds;
+    shm->header->frame_size = APA102_LED_FRAME_SIZE;
+    shm->header->slot_size = slot_size;
+    shm->header->slots_offset = slots_offset;
+    shm->leds = leds;
+    shm->slot_size = slot_size;
+    shm->slots_offset = slots_offset;
+    atomic_store_explicit(&shm->header->daemon, (int32_t)getpid(), memory_order_release);
+
+    return 0;
+}
+
+/**
+ * @brief Map the shared-memory segment of a running daemon (producer).
+ *
+ * @param shm Pointer to the mapping.
+ * @param name Name of the segment.
+ *
+ * @return `0` on success, `-1` if the segment does not exist or was created by a daemon with another layout or frame format.
+ *
+ * @details
+ * The slot layout is read once and checked against the size of the mapping and the number of LEDs.
+ */
+int apa102_shm_attach(APA102_Shm *shm, const char *name)
+{
+    struct stat status;
+    uint32_t leds;
+    uint64_t slot_size;
+    uint64_t slots_offset;
+    int descriptor = shm_open(name, O_RDWR, 0);
+
+    if (descriptor < 0)
+    {
+        return -1;
+    }
+
+    if (fstat(descriptor, &status) || ((unsigned long)status.st_size < sizeof(APA102_Shm_Header)) || apa102_shm_map(shm, descriptor, (unsigned long)status.st_size))
+    {
+        close(descriptor);
+        return -1;
+    }
+
+    leds = shm->header->leds;
+    slot_size = shm->header->slot_size;
+    slots_offset = shm->header->slots_offset;
+
+    if ((shm->header->magic != APA102_SHM_MAGIC) || (shm->header->version != APA102_SHM_VERSION) || (shm->header->frame_size != APA102_LED_FRAME_SIZE) ||
+        (slots_offset < sizeof(APA102_Shm_Header)) || (slots_offset > shm->size) ||
+        (slot_size < sizeof(APA102_Shm_Slot) + ((uint64_t)leds * apa102_shm_unit())) ||
+        (slot_size > (shm->size - slots_offset) / (APA102_SHM_PRODUCERS * APA102_SHM_SLOTS)))
+    {
+        apa102_shm_detach(shm);
+        return -1;
+    }
+
+    shm->leds = leds;
+    shm->slot_size = (unsigned long)slot_size;
+    shm->slots_offset = (unsigned long)slots_offset;
+
+    return 0;
+}
+
+/**
+ * @brief Unmap the shared-memory segment.
+ *
+ * @param shm Pointer to the mapping.
+ */
+void apa102_shm_detach(APA102_Shm *shm)
+{
+    if (shm->header)
+    {
+        munmap(shm->header, shm->size);
+    }
+    shm->header = 0;
+    shm->size = 0;
+    shm->leds = 0;
+    shm->slot_size = 0;
+    shm->slots_offset = 0;
+    shm->producer = -1;
+    shm->slot = 0;
+}
+
+/**
+ * @brief Claim a free producer entry.
+ *
+ * @param shm Pointer to the mapping.
+ *
+ * @return Index of the producer, `-1` if all `APA102_SHM_PRODUCERS` entries are in use.
+ *
+ * @details
+ * The counters of the entry are cleared. Entries of producers that exited without `apa102_shm_unregister()` are released by the daemon.
+ */
+int apa102_shm_register(APA102_Shm *shm)
+{
+    for (int i=0; i < APA102_SHM_PRODUCERS; i++)
+    {
+        APA102_Shm_Producer *producer = &shm->header->producers[i];
+        int32_t expected = 0;
+
+        if (atomic_compare_exchange_strong(&producer->pid, &expected, (int32_t)getpid()))
+        {
+            atomic_store(&producer->published, 0);
+            atomic_store(&producer->overruns, 0);
+            atomic_store(&producer->transmitted, 0);
+            atomic_store(&producer->torn, 0);
+            atomic_store(&producer->latency_sum, 0);
+            atomic_store(&producer->latency_max, 0);
+
+            shm->producer = i;
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Release the producer entry.
+ *
+ * @param shm Pointer to the mapping.
+ *
+ * @details
+ * Slots that were published before are still transmitted.
+ */
+void apa102_shm_unregister(APA102_Shm *shm)
+{
+    if (shm->producer >= 0)
+    {
+        atomic_store_explicit(&shm->header->producers[shm->producer].pid, 0, memory_order_release);
+    }
+    shm->producer = -1;
+    shm->slot = 0;
+}
+
+/**
+ * @brief Get a frame slot of a producer.
+ *
+ * @param shm Pointer to the mapping.
+ * @param producer Index of the producer.
+ * @param index Position in the ring (taken modulo `APA102_SHM_SLOTS`).
+ *
+ * @return Pointer to the slot header, the LED data follows directly.
+ */
+APA102_Shm_Slot *apa102_shm_slot(const APA102_Shm *shm, unsigned int producer, unsigned int index)
+{
+    unsigned long offset = shm->slots_offset + ((((unsigned long)producer * APA102_SHM_SLOTS) + (index % APA102_SHM_SLOTS)) * shm->slot_size);
+
+    return (APA102_Shm_Slot *)((unsigned char *)shm->header + offset);
+}
+
+/**
+ * @brief Start writing the next frame slot of the registered producer.
+ *
+ * @param shm Pointer to the mapping.
+ * @param first First LED of the range.
+ * @param count Number of LEDs of the range.
+ * @param format Format of the LED data.
+ *
+ * @return Pointer to the LED data of the slot (`count` LED frames or `GFX_RGBA_Color` values), `NULL` if the range exceeds the strip.
+ *
+ * @details
+ * The producer never waits: if the daemon has not consumed the oldest slot of the ring yet, it is overwritten and counted as overrun (or as torn while the daemon copies it) by the daemon. The slot has to be finished with `apa102_shm_publish()`.
+ */
+void *apa102_shm_acquire(APA102_Shm *shm, unsigned int first, unsigned int count, APA102_Shm_Format format)
+{
+    uint32_t head;
+    uint32_t sequence;
+
+    if ((shm->producer < 0) || !count || (first >= shm->leds) || (count > shm->leds - first))
+    {
+        return 0;
+    }
+
+    head = atomic_load_explicit(&shm->header->producers[shm->producer].head, memory_order_relaxed);
+    shm->slot = apa102_shm_slot(shm, (unsigned int)shm->producer, head);
+    sequence = atomic_load_explicit(&shm->slot->sequence, memory_order_relaxed);
+    atomic_store_explicit(&shm->slot->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    shm->slot->format = format;
+    shm->slot->first = first;
+    shm->slot->count = count;
+
+    return shm->slot + 1;
+}
+
+/**
+ * @brief Publish the slot started with `apa102_shm_acquire()` and wake the daemon.
+ *
+ * @param shm Pointer to the mapping.
+ */
+void apa102_shm_publish(APA102_Shm *shm)
+{
+    APA102_Shm_Producer *producer;
+
+    if (!shm->slot)
+    {
+        return;
+    }
+
+    producer = &shm->header->producers[shm->producer];
+    shm->slot->published = apa102_shm_now();
+    atomic_store_explicit(&shm->slot->sequence, atomic_load_explicit(&shm->slot->sequence, memory_order_relaxed) + 1, memory_order_release);
+    atomic_store_explicit(&producer->head, atomic_load_explicit(&producer->head, memory_order_relaxed) + 1, memory_order_release);
+    atomic_fetch_add_explicit(&producer->published, 1, memory_order_relaxed);
+    shm->slot = 0;
+
+    atomic_fetch_add_explicit(&shm->header->doorbell, 1, memory_order_release);
+    syscall(SYS_futex, (void *)&shm->header->doorbell, FUTEX_WAKE, 1, 0, 0, 0);
+}
+
+/**
+ * @brief Wait for the doorbell (daemon).
+ *
+ * @param shm Pointer to the mapping.
+ * @param doorbell Value of the doorbell read before the slots were checked.
+ * @param timeout Maximum waiting time in milliseconds.
+ *
+ * @details
+ * Returns immediately if a slot was published since `doorbell` was read, so no wake-up is lost.
+ */
+void apa102_shm_wait(APA102_Shm *shm, uint32_t doorbell, unsigned int timeout)
+{
+    struct timespec interval = { timeout / 1000U, (long)(timeout % 1000U) * 1000000L };
+
+    syscall(SYS_futex, (void *)&shm->header->doorbell, FUTEX_WAIT, doorbell, &interval, 0, 0);
+}
+
+/**
+ * @brief Get the time base of the slots.
+ *
+ * @return `CLOCK_MONOTONIC` time in nanoseconds.
+ */
+uint64_t apa102_shm_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file apa102_shm.h
+ * @brief Shared-memory frame source of the APA102 transmit daemon (Linux).
+ *
+ * This header file defines the layout of the POSIX shared-memory segment exposed by `apa102_shmd` and the functions used by producer processes. Every producer owns a ring of frame slots. A slot holds a range of LEDs either as LED frames in wire format (encoded with `apa102_encode()`) or as colors that the daemon encodes. A slot is protected by a sequence lock: the producer never waits for the daemon, and the daemon detects slots that were overwritten while it copied them. Published slots ring a futex doorbell that wakes the daemon, which merges the ranges of all producers into one LED data sequence. The daemon stores the latency from publishing to the end of the transmission and the overruns of every producer in the segment.
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#ifndef APA102_SHM_H_
+#define APA102_SHM_H_
+
+    #include <stdatomic.h>
+    #include <stdint.h>
+
+    #include "../../apa102.h"
+
+    /**
+     * @def APA102_SHM_NAME
+     * @brief Default name of the shared-memory segment (`/dev/shm/apa102`).
+     */
+    #define APA102_SHM_NAME "/apa102"
+
+    /**
+     * @def APA102_SHM_MAGIC
+     * @brief Identifier at the start of the segment (`APA2`).
+     */
+    #define APA102_SHM_MAGIC 0x32415041UL
+
+    /**
+     * @def APA102_SHM_VERSION
+     * @brief Version of the segment layout, increased with every incompatible change.
+     */
+    #define APA102_SHM_VERSION 1
+
+    /**
+     * @def APA102_SHM_PRODUCERS
+     * @brief Number of producers that can be attached at the same time.
+     */
+    #define APA102_SHM_PRODUCERS 8
+
+    /**
+     * @def APA102_SHM_SLOTS
+     * @brief Number of frame slots in the ring of every producer.
+     */
+    #define APA102_SHM_SLOTS 4
+
+    /**
+     * @enum APA102_Shm_Format_t
+     * @brief Enumerates the data formats of a frame slot.
+     *
+     * @details
+     * `APA102_Shm_Wire` slots hold LED frames of `APA102_LED_FRAME_SIZE` bytes (encoded by the producer with `apa102_encode()` of the same frame format), which are copied unchanged. `APA102_Shm_RGB` slots hold `GFX_RGBA_Color` values (intensity in `alpha`) that are encoded by the daemon including its color correction.
+     */
+    enum APA102_Shm_Format_t
+    {
+        APA102_Shm_Wire=0,
+        APA102_Shm_RGB
+    };
+    /**
+     * @typedef APA102_Shm_Format
+     * @brief Alias for enum APA102_Shm_Format_t representing the data format of a frame slot.
+     */
+    typedef enum APA102_Shm_Format_t APA102_Shm_Format;
+
+    /**
+     * @struct APA102_Shm_Slot_t
+     * @brief Header of a frame slot, the LED data follows directly.
+     *
+     * @details
+     * `sequence` is odd while the producer writes the slot. `published` is the `CLOCK_MONOTONIC` time in nanoseconds when the slot was published.
+     */
+    struct APA102_Shm_Slot_t
+    {
+        _Atomic uint32_t sequence;
+        uint32_t format;
+        uint32_t first;
+        uint32_t count;
+        uint64_t published;
+        uint64_t reserved;
+    };
+    /**
+     * @typedef APA102_Shm_Slot
+     * @brief Alias for struct APA102_Shm_Slot_t representing the header of a frame slot.
+     */
+    typedef struct APA102_Shm_Slot_t APA102_Shm_Slot;
+
+    /**
+     * @struct APA102_Shm_Producer_t
+     * @brief Ring state and counters of a producer.
+     *
+     * @details
+     * `pid` is `0` for a free entry. The producer advances `head` with every published slot, the daemon advances `tail` with every consumed slot. `published` is counted by the producer, `overruns` (slots overwritten before the daemon reached them), `transmitted`, `torn` (slots overwritten while the daemon copied them) and the latency in nanoseconds by the daemon. Every published slot is counted once, so `published` equals `transmitted + overruns + torn` when the daemon has caught up.
+     */
+    struct APA102_Shm_Producer_t
+    {
+        _Atomic int32_t pid;
+        _Atomic uint32_t head;
+        _Atomic uint32_t tail;
+        uint32_t reserved;
+        _Atomic uint64_t published;
+        _Atomic uint64_t overruns;
+        _Atomic uint64_t transmitted;
+        _Atomic uint64_t torn;
+        _Atomic uint64_t latency_sum;
+        _Atomic uint64_t latency_max;
+    };
+    /**
+     * @typedef APA102_Shm_Producer
+     * @brief Alias for struct APA102_Shm_Producer_t representing the ring state of a producer.
+     */
+    typedef struct APA102_Shm_Producer_t APA102_Shm_Producer;
+
+    /**
+     * @struct APA102_Shm_Header_t
+     * @brief Header at the start of the shared-memory segment.
+     *
+     * @details
+     * The slots of producer `p` start at `slots_offset + (p * APA102_SHM_SLOTS * slot_size)`. `doorbell` is the futex word incremented with every published slot. `leds` and `frame_size` are the configuration of the daemon, producers check `frame_size` against their own `APA102_LED_FRAME_SIZE`.
+     */
+    struct APA102_Shm_Header_t
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t leds;
+        uint32_t frame_size;
+        uint64_t slot_size;
+        uint64_t slots_offset;
+        _Atomic int32_t daemon;
+        _Atomic uint32_t doorbell;
+        _Atomic uint64_t frames;
+        APA102_Shm_Producer producers[APA102_SHM_PRODUCERS];
+    };
+    /**
+     * @typedef APA102_Shm_Header
+     * @brief Alias for struct APA102_Shm_Header_t representing the header of the shared-memory segment.
+     */
+    typedef struct APA102_Shm_Header_t APA102_Shm_Header;
+
+    /**
+     * @struct APA102_Shm_t
+     * @brief Mapping of the shared-memory segment in a process.
+     *
+     * @details
+     * `producer` is the index of the registered producer (`-1` in the daemon), `slot` the slot acquired with `apa102_shm_acquire()`. `leds`, `slot_size` and `slots_offset` are the configuration and slot layout of the segment, set by `apa102_shm_create()` or checked by `apa102_shm_attach()`. Slots are only located and filled with these private copies, so a process with write access to the segment can not move them out of the mapping.
+     */
+    struct APA102_Shm_t
+    {
+        APA102_Shm_Header *header;
+        unsigned long size;
+        unsigned int leds;
+        unsigned long slot_size;
+        unsigned long slots_offset;
+        int producer;
+        APA102_Shm_Slot *slot;
+    };
+    /**
+     * @typedef APA102_Shm
+     * @brief Alias for struct APA102_Shm_t representing the mapping of the shared-memory segment.
+     */
+    typedef struct APA102_Shm_t APA102_Shm;
+
+    int apa102_shm_create(APA102_Shm *shm, const char *name, unsigned int leds);
+    int apa102_shm_attach(APA102_Shm *shm, const char *name);
+    void apa102_shm_detach(APA102_Shm *shm);
+    int apa102_shm_register(APA102_Shm *shm);
+    void apa102_shm_unregister(APA102_Shm *shm);
+    void *apa102_shm_acquire(APA102_Shm *shm, unsigned int first, unsigned int count, APA102_Shm_Format format);
+    void apa102_shm_publish(APA102_Shm *shm);
+    APA102_Shm_Slot *apa102_shm_slot(const APA102_Shm *shm, unsigned int producer, unsigned int index);
+    void apa102_shm_wait(APA102_Shm *shm, uint32_t doorbell, unsigned int timeout);
+    uint64_t apa102_shm_now(void);
+
+#endif /* APA102_SHM_H_ */
@@ -0,0 +1,154 @@
+/**
+ * @file apa102_shm_producer.c
+ * @brief Test producer of the shared-memory frame source (Linux).
+ *
+ * This host tool attaches to a running `apa102_shmd`, registers as producer and publishes a moving color gradient on a range of LEDs at a fixed frame rate, either as colors (`APA102_Shm_RGB`) or as LED frames encoded with `apa102_encode()` (`APA102_Shm_Wire`). After the last frame it prints its counters from the segment: published and overwritten slots, transmitted slots and the latency measured by the daemon. Several producers on disjoint ranges show how the daemon merges them into one LED data sequence.
+ *
+ * @code
+ * apa102_shm_producer [-s name] [-f first] [-c count] [-r fps] [-t frames] [-w]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "apa102_shm.h"
+
+unsigned char spi_transfer(unsigned char data)
+{
+    return data;
+}
+
+static void producer_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-s name] [-f first] [-c count] [-r fps] [-t frames] [-w]\n", name);
+}
+
+static void producer_color(unsigned int led, unsigned int frame, GFX_RGBA_Color *color)
+{
+    unsigned char phase = (unsigned char)((led * 8U) + (frame * 4U));
+
+    *color = (GFX_RGBA_Color){ APA102_MAX_INTENSITY, phase, (unsigned char)(0xFF - phase), (unsigned char)(frame & 0xFF) };
+}
+
+int main(int argc, char *argv[])
+{
+    APA102_Shm shm = { 0 };
+    const char *name = APA102_SHM_NAME;
+    unsigned int first = 0;
+    unsigned int count = 0;
+    unsigned int rate = 60;
+    unsigned int frames = 600;
+    APA102_Shm_Format format = APA102_Shm_RGB;
+    struct timespec due;
+    int option;
+
+    while ((option = getopt(argc, argv, "s:f:c:r:t:w")) != -1)
+    {
+        switch (option)
+        {
+            case 's': name = optarg; break;
+            case 'f': first = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'c': count = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'r': rate = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 't': frames = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'w': format = APA102_Shm_Wire; break;
+            default:
+                producer_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (apa102_shm_attach(&shm, name))
+    {
+        fprintf(stderr, "%s: no compatible daemon at %s\n", argv[0], name);
+        return 1;
+    }
+
+    if (!count && (first < shm.leds))
+    {
+        count = shm.leds - first;
+    }
+
+    if (apa102_shm_register(&shm) < 0)
+    {
+        fprintf(stderr, "%s: all %u producer entries are in use\n", argv[0], APA102_SHM_PRODUCERS);
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &due);
+
+    for (unsigned int frame=0; frame < frames; frame++)
+    {
+        void *data = apa102_shm_acquire(&shm, first, count, format);
+
+        if (!data)
+        {
+            fprintf(stderr, "%s: LEDs %u..%u exceed the strip of %u LEDs\n", argv[0], first, first + count - 1, shm.leds);
+            apa102_shm_unregister(&shm);
+            return 1;
+        }
+
+        for (unsigned int i=0; i < count; i++)
+        {
+            GFX_RGBA_Color color;
+
+            producer_color(first + i, frame, &color);
+
+            if (format == APA102_Shm_Wire)
+            {
+                apa102_encode(first + i, APA102_START_FLAG | (0x3F & color.alpha), &color, (unsigned char *)data + ((unsigned long)i * APA102_LED_FRAME_SIZE));
+            }
+            else
+            {
+                ((GFX_RGBA_Color *)data)[i] = color;
+            }
+        }
+        apa102_shm_publish(&shm);
+
+        if (rate)
+        {
+            due.tv_nsec += 1000000000L / rate;
+
+            if (due.tv_nsec >= 1000000000L)
+            {
+                due.tv_sec++;
+                due.tv_nsec -= 1000000000L;
+            }
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, 0);
+        }
+    }
+
+    // Give the daemon time to transmit the last slot before the counters are read
+    nanosleep(&(struct timespec){ 0, 100000000L }, 0);
+
+    APA102_Shm_Producer *producer = &shm.header->producers[shm.producer];
+    uint64_t transmitted = atomic_load(&producer->transmitted);
+
+    printf("producer %d: LEDs %u..%u (%s), published %llu, overruns %llu, transmitted %llu, torn %llu, latency avg %.1f us (max %.1f us)\n",
+           shm.producer, first, first + count - 1, (format == APA102_Shm_Wire) ? "wire" : "rgb",
+           (unsigned long long)atomic_load(&producer->published), (unsigned long long)atomic_load(&producer->overruns),
+           (unsigned long long)transmitted, (unsigned long long)atomic_load(&producer->torn),
+           transmitted ? ((double)atomic_load(&producer->latency_sum) / transmitted / 1e3) : 0.0,
+           (double)atomic_load(&producer->latency_max) / 1e3);
+
+    apa102_shm_unregister(&shm);
+    apa102_shm_detach(&shm);
+
+    return 0;
+}
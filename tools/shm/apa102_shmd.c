@@ -0,0 +1,338 @@
+/**
+ * @file apa102_shmd.c
+ * @brief Transmit daemon with a shared-memory frame source (Linux).
+ *
+ * This host tool owns the LED strip and exposes the shared-memory segment of `apa102_shm.h`. It sleeps on the futex doorbell until a producer publishes a slot, copies the published slots of all producers into one buffer of LED frames (wire slots unchanged, RGB slots encoded with `apa102_encode()`) and writes the LED data sequence to a device (e.g. `spidev`) or a file. Producers that publish faster than the strip can be written only lose intermediate frames, the newest slot of every producer is always transmitted. The latency from publishing to the written sequence and the overruns are stored per producer in the segment and printed periodically (`-p`) and at exit.
+ *
+ * @code
+ * apa102_shmd [-s name] [-n leds] [-r fps] [-p seconds] [-o output]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "apa102_shm.h"
+
+typedef struct
+{
+    unsigned int producer;
+    uint64_t published;
+} Shmd_Pending;
+
+typedef struct
+{
+    APA102_Shm shm;
+    unsigned int leds;
+    unsigned char *frames;
+    unsigned char *scratch;
+    Shmd_Pending pending[2 * APA102_SHM_PRODUCERS * APA102_SHM_SLOTS];
+    unsigned int count;
+} Shmd_Context;
+
+static unsigned char *shmd_wire;
+static unsigned long shmd_wire_size;
+static unsigned long shmd_wire_length;
+static volatile sig_atomic_t shmd_stop;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    if (shmd_wire_length < shmd_wire_size)
+    {
+        shmd_wire[shmd_wire_length++] = data;
+    }
+    return data;
+}
+
+static void shmd_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-s name] [-n leds] [-r fps] [-p seconds] [-o output]\n", name);
+}
+
+static void shmd_signal(int number)
+{
+    (void)number;
+    shmd_stop = 1;
+}
+
+static void shmd_apply(Shmd_Context *context, const APA102_Shm_Slot *slot)
+{
+    unsigned char *frames = context->frames + ((unsigned long)slot->first * APA102_LED_FRAME_SIZE);
+
+    if (slot->format == APA102_Shm_Wire)
+    {
+        memcpy(frames, context->scratch, (unsigned long)slot->count * APA102_LED_FRAME_SIZE);
+        return;
+    }
+
+    for (unsigned int i=0; i < slot->count; i++)
+    {
+        const GFX_RGBA_Color *color = (const GFX_RGBA_Color *)context->scratch + i;
+
+        apa102_encode(slot->first + i, APA102_START_FLAG | (0x3F & color->alpha), color, frames + ((unsigned long)i * APA102_LED_FRAME_SIZE));
+    }
+}
+
+static void shmd_collect(Shmd_Context *context)
+{
+    APA102_Shm_Header *header = context->shm.header;
+
+    for (unsigned int p=0; p < APA102_SHM_PRODUCERS; p++)
+    {
+        APA102_Shm_Producer *producer = &header->producers[p];
+        uint32_t head = atomic_load_explicit(&producer->head, memory_order_acquire);
+        uint32_t tail = atomic_load_explicit(&producer->tail, memory_order_relaxed);
+
+        // Slots that were overwritten before the daemon reached them are lost, every published slot is counted once
+        if ((uint32_t)(head - tail) > APA102_SHM_SLOTS)
+        {
+            atomic_fetch_add_explicit(&producer->overruns, (uint32_t)(head - tail) - APA102_SHM_SLOTS, memory_order_relaxed);
+            tail = head - APA102_SHM_SLOTS;
+        }
+
+        while (tail != head)
+        {
+            APA102_Shm_Slot *slot = apa102_shm_slot(&context->shm, p, tail);
+            APA102_Shm_Slot copy;
+            int consumed = 0;
+            uint32_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+            copy.format = slot->format;
+            copy.first = slot->first;
+            copy.count = slot->count;
+            copy.published = slot->published;
+
+            if (!(sequence & 1U) && (copy.first < context->leds) && (copy.count <= context->leds - copy.first))
+            {
+                memcpy(context->scratch, slot + 1, (unsigned long)copy.count * ((copy.format == APA102_Shm_Wire) ? APA102_LED_FRAME_SIZE : sizeof(GFX_RGBA_Color)));
+                atomic_thread_fence(memory_order_acquire);
+
+                consumed = (atomic_load_explicit(&slot->sequence, memory_order_relaxed) == sequence);
+            }
+
+            if (consumed)
+            {
+                shmd_apply(context, &copy);
+                context->pending[context->count++] = (Shmd_Pending){ p, copy.published };
+            }
+            else
+            {
+                atomic_fetch_add_explicit(&producer->torn, 1, memory_order_relaxed);
+            }
+            atomic_store_explicit(&producer->tail, ++tail, memory_order_release);
+        }
+    }
+}
+
+static void shmd_account(Shmd_Context *context, uint64_t now)
+{
+    for (unsigned int i=0; i < context->count; i++)
+    {
+        APA102_Shm_Producer *producer = &context->shm.header->producers[context->pending[i].producer];
+        uint64_t latency = now - context->pending[i].published;
+
+        atomic_fetch_add_explicit(&producer->transmitted, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&producer->latency_sum, latency, memory_order_relaxed);
+
+        if (latency > atomic_load_explicit(&producer->latency_max, memory_order_relaxed))
+        {
+            atomic_store_explicit(&producer->latency_max, latency, memory_order_relaxed);
+        }
+    }
+    atomic_fetch_add_explicit(&context->shm.header->frames, 1, memory_order_relaxed);
+}
+
+static void shmd_reap(Shmd_Context *context)
+{
+    for (unsigned int p=0; p < APA102_SHM_PRODUCERS; p++)
+    {
+        int32_t pid = atomic_load(&context->shm.header->producers[p].pid);
+
+        if (pid && kill(pid, 0) && (errno == ESRCH))
+        {
+            fprintf(stderr, "producer %u (pid %d) exited without unregistering\n", p, (int)pid);
+            atomic_compare_exchange_strong(&context->shm.header->producers[p].pid, &pid, 0);
+        }
+    }
+}
+
+static void shmd_report(const Shmd_Context *context)
+{
+    fprintf(stderr, "%llu frames\n", (unsigned long long)atomic_load(&context->shm.header->frames));
+
+    for (unsigned int p=0; p < APA102_SHM_PRODUCERS; p++)
+    {
+        APA102_Shm_Producer *producer = &context->shm.header->producers[p];
+        uint64_t published = atomic_load(&producer->published);
+        uint64_t transmitted = atomic_load(&producer->transmitted);
+
+        if (!atomic_load(&producer->pid) && !published)
+        {
+            continue;
+        }
+
+        fprintf(stderr, "producer %u (pid %d): published %llu, transmitted %llu, overruns %llu, torn %llu, latency avg %.1f us (max %.1f us)\n",
+                p, (int)atomic_load(&producer->pid),
+                (unsigned long long)published, (unsigned long long)transmitted,
+                (unsigned long long)atomic_load(&producer->overruns), (unsigned long long)atomic_load(&producer->torn),
+                transmitted ? ((double)atomic_load(&producer->latency_sum) / transmitted / 1e3) : 0.0,
+                (double)atomic_load(&producer->latency_max) / 1e3);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Shmd_Context context = { 0 };
+    struct sigaction action;
+    const char *name = APA102_SHM_NAME;
+    const char *output = "/dev/null";
+    unsigned int leds = APA102_NUMBER_OF_LEDS;
+    unsigned int rate = 0;
+    unsigned int period = 0;
+    uint64_t transmitted = 0;
+    uint64_t reported;
+    int option;
+
+    while ((option = getopt(argc, argv, "s:n:r:p:o:")) != -1)
+    {
+        switch (option)
+        {
+            case 's': name = optarg; break;
+            case 'n': leds = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'r': rate = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'p': period = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'o': output = optarg; break;
+            default:
+                shmd_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!leds || (leds > APA102_NUMBER_OF_LEDS))
+    {
+        fprintf(stderr, "%s: invalid configuration (at most %u LEDs)\n", argv[0], (unsigned int)APA102_NUMBER_OF_LEDS);
+        shmd_usage(argv[0]);
+        return 1;
+    }
+
+    context.leds = leds;
+    context.frames = malloc((unsigned long)leds * APA102_LED_FRAME_SIZE);
+    context.scratch = malloc((unsigned long)leds * ((APA102_LED_FRAME_SIZE > sizeof(GFX_RGBA_Color)) ? APA102_LED_FRAME_SIZE : sizeof(GFX_RGBA_Color)));
+    shmd_wire_size = APA102_FRAME_SIZE + ((unsigned long)leds * APA102_LED_FRAME_SIZE) + APA102_EOF_SIZE;
+    shmd_wire = malloc(shmd_wire_size);
+
+    if (!context.frames || !context.scratch || !shmd_wire)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    }
+
+    // LEDs without a producer stay switched off
+    for (unsigned int i=0; i < leds; i++)
+    {
+        apa102_encode(i, APA102_START_FLAG | APA102_MIN_INTENSITY, &(GFX_RGBA_Color){ APA102_MIN_INTENSITY, 0x00, 0x00, 0x00 }, context.frames + ((unsigned long)i * APA102_LED_FRAME_SIZE));
+    }
+
+    int device = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (device < 0)
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], output);
+        return 1;
+    }
+
+    if (apa102_shm_create(&context.shm, name, leds))
+    {
+        fprintf(stderr, "%s: cannot create shared memory %s: %s\n", argv[0], name, strerror(errno));
+        return 1;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = shmd_signal;
+    sigaction(SIGINT, &action, 0);
+    sigaction(SIGTERM, &action, 0);
+
+    fprintf(stderr, "%s: %u LEDs, %u producers with %u slots of %llu bytes\n", name, leds, APA102_SHM_PRODUCERS, APA102_SHM_SLOTS, (unsigned long long)context.shm.slot_size);
+    reported = apa102_shm_now();
+
+    while (!shmd_stop)
+    {
+        uint32_t doorbell = atomic_load_explicit(&context.shm.header->doorbell, memory_order_acquire);
+        uint64_t now;
+
+        context.count = 0;
+        shmd_collect(&context);
+
+        if (context.count)
+        {
+            // The frame rate limit lets fast producers coalesce into one sequence
+            if (rate && transmitted)
+            {
+                uint64_t due = transmitted + (1000000000ULL / rate);
+
+                now = apa102_shm_now();
+
+                if (due > now)
+                {
+                    struct timespec interval = { (time_t)((due - now) / 1000000000ULL), (long)((due - now) % 1000000000ULL) };
+
+                    nanosleep(&interval, 0);
+                    shmd_collect(&context);
+                }
+            }
+
+            shmd_wire_length = 0;
+            APA102_SOF();
+            apa102_write(context.frames, leds * APA102_LED_FRAME_SIZE);
+            APA102_EOF();
+
+            if (write(device, shmd_wire, shmd_wire_length) != (ssize_t)shmd_wire_length)
+            {
+                fprintf(stderr, "%s: cannot write to %s\n", argv[0], output);
+                break;
+            }
+
+            transmitted = apa102_shm_now();
+            shmd_account(&context, transmitted);
+            continue;
+        }
+
+        shmd_reap(&context);
+        now = apa102_shm_now();
+
+        if (period && ((now - reported) >= (uint64_t)period * 1000000000ULL))
+        {
+            shmd_report(&context);
+            reported = now;
+        }
+
+        apa102_shm_wait(&context.shm, doorbell, 100);
+    }
+
+    shmd_report(&context);
+    shm_unlink(name);
+    apa102_shm_detach(&context.shm);
+    close(device);
+
+    return 0;
+}
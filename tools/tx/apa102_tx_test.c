@@ -0,0 +1,278 @@
+/**
+ * @file apa102_tx_test.c
+ * @brief Host test of the cooperative transmission against a blocking refresh.
+ *
+ * This host tool sends the same LED buffer once as a blocking refresh (`APA102_SOF()`, `apa102_led()` per LED, `APA102_EOF()`) and once with `apa102_tx_begin()` and repeated `apa102_tx_poll()` calls, and compares the SPI bytes of both. It covers byte budgets from 1 up to the LED frame size and larger, varying budgets and buffers of 0, 1, 64, 65 and `APA102_NUMBER_OF_LEDS` LEDs. Built with `APA102_CALIBRATION_AVAILABLE` a calibration table is loaded, built with `APA102_RECORDER_AVAILABLE` all sequences are recorded to a capture file and its bytes are compared with the SPI bytes. The tool exits with a non-zero status on the first mismatch.
+ *
+ * @code
+ * apa102_tx_test
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../../apa102_tx.h"
+
+#ifdef APA102_CALIBRATION_AVAILABLE
+    #include "../../apa102_calibration.h"
+#endif
+
+#ifdef APA102_RECORDER_AVAILABLE
+    #include "../../apa102_recorder.h"
+#endif
+
+#define TX_TEST_SIZE (APA102_FRAME_SIZE + (APA102_NUMBER_OF_LEDS * APA102_LED_FRAME_SIZE) + APA102_EOF_SIZE)
+
+static unsigned char tx_test_wire[TX_TEST_SIZE];
+static unsigned long tx_test_length;
+static unsigned char *tx_test_stream;
+static unsigned long tx_test_stream_length;
+static unsigned long tx_test_stream_size;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    if (tx_test_length < sizeof(tx_test_wire))
+    {
+        tx_test_wire[tx_test_length] = data;
+    }
+    tx_test_length++;
+
+    if (tx_test_stream_length < tx_test_stream_size)
+    {
+        tx_test_stream[tx_test_stream_length] = data;
+    }
+    tx_test_stream_length++;
+
+    return data;
+}
+
+static void tx_test_colors(GFX_RGBA_Color *colors, unsigned int leds, unsigned int seed)
+{
+    for (unsigned int i=0; i < leds; i++)
+    {
+        unsigned int value = (i * 2654435761U) ^ (seed * 40503U);
+
+        colors[i] = (GFX_RGBA_Color){ (unsigned char)(value >> 3), (unsigned char)value, (unsigned char)(value >> 8), (unsigned char)(value >> 16) };
+    }
+}
+
+static unsigned long tx_test_reference(const GFX_RGBA_Color *colors, unsigned int leds, unsigned char *wire)
+{
+    tx_test_length = 0;
+
+    APA102_SOF();
+
+    for (unsigned int i=0; i < leds; i++)
+    {
+        apa102_led(&colors[i]);
+    }
+
+    APA102_EOF();
+
+    memcpy(wire, tx_test_wire, (tx_test_length < sizeof(tx_test_wire)) ? tx_test_length : sizeof(tx_test_wire));
+    return tx_test_length;
+}
+
+static unsigned int tx_test_budget(unsigned int budget, unsigned long call)
+{
+    // Budget 0 selects a varying budget between 1 and 17 bytes
+    return budget ? budget : (unsigned int)(1 + ((call * 7U) % 17U));
+}
+
+static int tx_test_run(const GFX_RGBA_Color *colors, unsigned int leds, unsigned int budget, const unsigned char *expected, unsigned long length)
+{
+    unsigned long calls = 0;
+
+    tx_test_length = 0;
+
+    if (apa102_tx_begin(colors, leds) != APA102_Tx_Busy)
+    {
+        fprintf(stderr, "%u LEDs, budget %u: apa102_tx_begin() did not start\n", leds, budget);
+        return 1;
+    }
+
+    while (apa102_tx_poll(tx_test_budget(budget, calls)) == APA102_Tx_Busy)
+    {
+        // Every call has to send its full budget while bytes are left
+        if (tx_test_length != (calls + 1) * budget && budget)
+        {
+            fprintf(stderr, "%u LEDs, budget %u: call %lu sent %lu bytes in total\n", leds, budget, calls, tx_test_length);
+            return 1;
+        }
+
+        if (++calls > TX_TEST_SIZE)
+        {
+            fprintf(stderr, "%u LEDs, budget %u: transmission does not finish\n", leds, budget);
+            return 1;
+        }
+    }
+
+    if (tx_test_length != length)
+    {
+        fprintf(stderr, "%u LEDs, budget %u: %lu bytes instead of %lu\n", leds, budget, tx_test_length, length);
+        return 1;
+    }
+
+    for (unsigned long i=0; i < length; i++)
+    {
+        if (tx_test_wire[i] != expected[i])
+        {
+            fprintf(stderr, "%u LEDs, budget %u: byte %lu is 0x%02X instead of 0x%02X\n", leds, budget, i, tx_test_wire[i], expected[i]);
+            return 1;
+        }
+    }
+
+    if (apa102_tx_poll(1) != APA102_Tx_Idle || tx_test_length != length)
+    {
+        fprintf(stderr, "%u LEDs, budget %u: bytes sent after the end of the transmission\n", leds, budget);
+        return 1;
+    }
+    return 0;
+}
+
+#ifdef APA102_RECORDER_AVAILABLE
+
+    static int tx_test_capture(const char *path)
+    {
+        FILE *file = fopen(path, "rb");
+        unsigned char header[20];
+        unsigned long offset = 0;
+
+        if (!file || (fread(header, 1, 8, file) != 8) || memcmp(header, APA102_RECORDER_MAGIC, 4))
+        {
+            fprintf(stderr, "recorder: cannot read %s\n", path);
+            return 1;
+        }
+
+        while (fread(header, 1, sizeof(header), file) == sizeof(header))
+        {
+            unsigned long length = (unsigned long)header[16] | ((unsigned long)header[17] << 8) | ((unsigned long)header[18] << 16) | ((unsigned long)header[19] << 24);
+
+            for (unsigned long i=0; i < length; i++, offset++)
+            {
+                int data = fgetc(file);
+
+                if ((data == EOF) || (offset >= tx_test_stream_length) || ((unsigned char)data != tx_test_stream[offset]))
+                {
+                    fprintf(stderr, "recorder: byte %lu differs from the SPI bytes\n", offset);
+                    fclose(file);
+                    return 1;
+                }
+            }
+        }
+        fclose(file);
+
+        if (offset != tx_test_stream_length)
+        {
+            fprintf(stderr, "recorder: %lu bytes recorded instead of %lu\n", offset, tx_test_stream_length);
+            return 1;
+        }
+        return 0;
+    }
+
+#endif
+
+int main(void)
+{
+    static GFX_RGBA_Color colors[APA102_NUMBER_OF_LEDS];
+    static unsigned char expected[TX_TEST_SIZE];
+    const unsigned int counts[] = { 0, 1, 64, 65, APA102_NUMBER_OF_LEDS };
+    const unsigned int budgets[] = { APA102_LED_FRAME_SIZE + 1, 7, 64, 1000, 65535, 0 };
+    unsigned long runs = 0;
+
+    #ifdef APA102_CALIBRATION_AVAILABLE
+        static unsigned char delta[((APA102_NUMBER_OF_LEDS * 3) + 1) / 2];
+        static APA102_Calibration calibration = { { 0xF0, 0xE0, 0xFF }, delta, APA102_NUMBER_OF_LEDS - 10 };
+
+        for (unsigned int i=0; i < sizeof(delta); i++)
+        {
+            delta[i] = (unsigned char)((i * 37U) + 11U);
+        }
+        apa102_calibration_load(&calibration);
+    #endif
+
+    #ifdef APA102_RECORDER_AVAILABLE
+        char path[] = "/tmp/apa102_tx_test_XXXXXX";
+        int descriptor = mkstemp(path);
+
+        if ((descriptor < 0) || (apa102_recorder_open(path) != APA102_Recorder_Ok))
+        {
+            fprintf(stderr, "recorder: cannot create a capture file\n");
+            return EXIT_FAILURE;
+        }
+        close(descriptor);
+    #endif
+
+    tx_test_stream_size = 64UL * 1024UL * 1024UL;
+    tx_test_stream = malloc(tx_test_stream_size);
+
+    if (!tx_test_stream)
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    for (unsigned int c=0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        unsigned int leds = counts[c];
+
+        tx_test_colors(colors, leds, c);
+        unsigned long length = tx_test_reference(colors, leds, expected);
+
+        if (length != APA102_FRAME_SIZE + ((unsigned long)leds * APA102_LED_FRAME_SIZE) + APA102_EOF_SIZE)
+        {
+            fprintf(stderr, "%u LEDs: blocking refresh sent %lu bytes\n", leds, length);
+            return EXIT_FAILURE;
+        }
+
+        for (unsigned int budget=1; budget <= APA102_LED_FRAME_SIZE; budget++, runs++)
+        {
+            if (tx_test_run(colors, leds, budget, expected, length))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        for (unsigned int b=0; b < sizeof(budgets) / sizeof(budgets[0]); b++, runs++)
+        {
+            if (tx_test_run(colors, leds, budgets[b], expected, length))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    #ifdef APA102_RECORDER_AVAILABLE
+        apa102_recorder_close();
+
+        int failed = tx_test_capture(path);
+
+        unlink(path);
+
+        if (failed)
+        {
+            return EXIT_FAILURE;
+        }
+    #endif
+
+    free(tx_test_stream);
+    printf("%lu transmissions match the blocking refresh\n", runs);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,736 @@
+/**
+ * @file apa102_video.c
+ * @brief Host tool downsampling a raw video stream onto a LED map.
+ *
+ * This host tool reads raw video (YUV4MPEG2 with 4:2:0 or 4:4:4 chroma, or packed RGB24) from a file or stdin and area-averages every frame onto the LEDs of a map. The map is a matrix (wired with the layouts of `apa102_matrix_position()`) or a file with the position and size of every LED. The sampling weights of every LED are computed once, so a frame only needs one weighted sum per LED and plane (SSE2 or NEON on hosts). The LEDs are split between worker threads, the next frame is read while the workers sample the current one. The LED frames are written to a device (e.g. `spidev`) or a file.
+ *
+ * @code
+ * apa102_video (-g WxH [-L layout] | -M map) [-s WxH] [-S size] [-i intensity] [-t threads] [-o output] [input|-]
+ * @endcode
+ *
+ * @author g.raf
+ * @date 2026-10-17
+ * @version 1.0 Release
+ * @copyright
+ * Copyright (c) 2026 g.raf
+ * Released under the GPLv3 License. (see LICENSE in repository)
+ *
+ * @note This file is part of a larger embedded systems project and subject to the license specified in the repository. For updates  and the complete revision history, see the GitHub repository.
+ *
+ * @see https://github.com/0x007e/drivers-led-apa102 "APA102 LED Driver GitHub Repository"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+#include "../../apa102_matrix.h"
+
+#define VIDEO_HEADER 256
+#define VIDEO_THREADS 64
+
+typedef enum
+{
+    Video_YUV420=0,
+    Video_YUV444,
+    Video_RGB
+} Video_Format;
+
+typedef struct
+{
+    unsigned int first;
+    unsigned int count;
+    uint16_t *weights;
+    uint32_t total;
+} Video_Span;
+
+typedef struct
+{
+    Video_Span x;
+    Video_Span y;
+} Video_Area;
+
+typedef struct
+{
+    Video_Area luma;
+    Video_Area chroma;
+} Video_Led;
+
+typedef struct Video_Context_t Video_Context;
+
+typedef struct
+{
+    Video_Context *context;
+    unsigned int index;
+    pthread_t thread;
+} Video_Worker;
+
+struct Video_Context_t
+{
+    /* input */
+    int input;
+    Video_Format format;
+    int full;
+    unsigned int width;
+    unsigned int height;
+    unsigned int chroma_width;
+    unsigned int chroma_height;
+    size_t size;
+    double fps;
+    unsigned char *frame[2];
+    const unsigned char *current;
+
+    /* planes of RGB24 input */
+    unsigned char *plane[3];
+
+    /* map */
+    unsigned int leds;
+    Video_Led *map;
+    GFX_RGBA_Color *colors;
+    unsigned char intensity;
+
+    /* workers */
+    unsigned int threads;
+    Video_Worker worker[VIDEO_THREADS];
+    pthread_barrier_t start;
+    pthread_barrier_t done;
+    pthread_barrier_t phase;
+    int quit;
+};
+
+static unsigned char *video_wire;
+static unsigned long video_wire_size;
+static unsigned long video_wire_length;
+
+unsigned char spi_transfer(unsigned char data)
+{
+    if (video_wire_length < video_wire_size)
+    {
+        video_wire[video_wire_length++] = data;
+    }
+    return data;
+}
+
+static uint64_t video_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000ULL);
+}
+
+static int video_read(int input, void *data, size_t length)
+{
+    unsigned char *position = data;
+
+    while (length)
+    {
+        ssize_t count = read(input, position, length);
+
+        if (count <= 0)
+        {
+            return -1;
+        }
+        position += count;
+        length -= (size_t)count;
+    }
+    return 0;
+}
+
+static int video_line(int input, char *line, size_t length)
+{
+    for (size_t i=0; i < (length - 1); i++)
+    {
+        if (video_read(input, &line[i], 1))
+        {
+            return -1;
+        }
+        if (line[i] == '\n')
+        {
+            line[i] = '\0';
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static int video_y4m(Video_Context *context, const char *header)
+{
+    const char *token = header + strlen("YUV4MPEG2");
+
+    context->format = Video_YUV420;
+
+    while ((token = strchr(token, ' ')))
+    {
+        token++;
+
+        switch (*token)
+        {
+            case 'W': context->width = (unsigned int)strtoul(token + 1, 0, 10); break;
+            case 'H': context->height = (unsigned int)strtoul(token + 1, 0, 10); break;
+            case 'F':
+            {
+                char *end;
+                double numerator = strtod(token + 1, &end);
+                double denominator = (*end == ':') ? strtod(end + 1, 0) : 1.0;
+
+                context->fps = (denominator > 0.0) ? (numerator / denominator) : 0.0;
+                break;
+            }
+            case 'C':
+                if (!strncmp(token + 1, "444", 3) && (token[4] != 'a'))
+                {
+                    context->format = Video_YUV444;
+                }
+                else if (strncmp(token + 1, "420", 3))
+                {
+                    fprintf(stderr, "only 4:2:0 and 4:4:4 chroma is supported\n");
+                    return -1;
+                }
+                break;
+            case 'X':
+                if (!strncmp(token, "XCOLORRANGE=FULL", 16))
+                {
+                    context->full = 1;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return (context->width && context->height) ? 0 : -1;
+}
+
+/* pixels covered by [start, end) with the coverage of every pixel in Q8 */
+static int video_span(Video_Span *span, double start, double end, unsigned int limit)
+{
+    if (start < 0.0)
+    {
+        start = 0.0;
+    }
+    if (end > limit)
+    {
+        end = limit;
+    }
+    if (end <= start)
+    {
+        double center = (start < limit) ? start : (limit - 0.5);
+
+        start = floor(center);
+        end = start + 1.0;
+    }
+
+    unsigned int first = (unsigned int)floor(start);
+    unsigned int last = (unsigned int)ceil(end);
+
+    span->first = first;
+    span->count = last - first;
+    span->weights = malloc(span->count * sizeof(uint16_t));
+    span->total = 0;
+
+    if (!span->weights)
+    {
+        return -1;
+    }
+
+    for (unsigned int i=0; i < span->count; i++)
+    {
+        double low = (first + i) > start ? (first + i) : start;
+        double high = (first + i + 1.0) < end ? (first + i + 1.0) : end;
+        uint16_t weight = (uint16_t)lround((high - low) * 256.0);
+
+        span->weights[i] = weight;
+        span->total += weight;
+    }
+
+    if (!span->total)
+    {
+        span->weights[0] = 1;
+        span->total = 1;
+    }
+    return 0;
+}
+
+static int video_area(Video_Context *context, Video_Led *led, double left, double top, double right, double bottom)
+{
+    if (video_span(&led->luma.x, left * context->width, right * context->width, context->width) ||
+        video_span(&led->luma.y, top * context->height, bottom * context->height, context->height))
+    {
+        return -1;
+    }
+
+    if (context->format == Video_YUV420)
+    {
+        if (video_span(&led->chroma.x, left * context->chroma_width, right * context->chroma_width, context->chroma_width) ||
+            video_span(&led->chroma.y, top * context->chroma_height, bottom * context->chroma_height, context->chroma_height))
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        led->chroma = led->luma;
+    }
+    return 0;
+}
+
+static int video_grid(Video_Context *context, const APA102_Matrix *matrix)
+{
+    for (unsigned int i=0; i < context->leds; i++)
+    {
+        unsigned int x, y;
+
+        apa102_matrix_position(matrix, i, &x, &y);
+
+        if (video_area(context, &context->map[i], (double)x / matrix->width, (double)y / matrix->height, (double)(x + 1) / matrix->width, (double)(y + 1) / matrix->height))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* map file: one LED per line, "x y [w h]" in fractions of the frame (center and size) */
+static int video_map(Video_Context *context, const char *path, double size, int setup)
+{
+    FILE *file = fopen(path, "r");
+    char line[256];
+    unsigned int led = 0;
+
+    if (!file)
+    {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file))
+    {
+        double x, y, w = size, h = size;
+        int values = sscanf(line, "%lf %lf %lf %lf", &x, &y, &w, &h);
+
+        if ((values < 2) || (line[0] == '#'))
+        {
+            continue;
+        }
+        if (values == 3)
+        {
+            h = w;
+        }
+
+        if (setup && video_area(context, &context->map[led], x - (w / 2.0), y - (h / 2.0), x + (w / 2.0), y + (h / 2.0)))
+        {
+            fclose(file);
+            return -1;
+        }
+        led++;
+    }
+
+    fclose(file);
+    return (int)led;
+}
+
+/* weighted sum of a row, pixels * weights (Q8) */
+static uint32_t video_dot(const unsigned char *pixels, const uint16_t *weights, unsigned int count)
+{
+    uint32_t sum = 0;
+    unsigned int i = 0;
+
+    #if defined(__SSE2__)
+        const __m128i zero = _mm_setzero_si128();
+        __m128i accumulator = zero;
+
+        for (; (i + 8) <= count; i += 8)
+        {
+            __m128i pixel = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)&pixels[i]), zero);
+            __m128i weight = _mm_loadu_si128((const __m128i *)&weights[i]);
+
+            accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(pixel, weight));
+        }
+        accumulator = _mm_add_epi32(accumulator, _mm_shuffle_epi32(accumulator, 0x4E));
+        accumulator = _mm_add_epi32(accumulator, _mm_shuffle_epi32(accumulator, 0xB1));
+        sum = (uint32_t)_mm_cvtsi128_si32(accumulator);
+    #elif defined(__ARM_NEON)
+        uint32x4_t accumulator = vdupq_n_u32(0);
+
+        for (; (i + 8) <= count; i += 8)
+        {
+            uint16x8_t pixel = vmovl_u8(vld1_u8(&pixels[i]));
+            uint16x8_t weight = vld1q_u16(&weights[i]);
+
+            accumulator = vmlal_u16(accumulator, vget_low_u16(pixel), vget_low_u16(weight));
+            accumulator = vmlal_u16(accumulator, vget_high_u16(pixel), vget_high_u16(weight));
+        }
+        sum = vgetq_lane_u32(accumulator, 0) + vgetq_lane_u32(accumulator, 1) + vgetq_lane_u32(accumulator, 2) + vgetq_lane_u32(accumulator, 3);
+    #endif
+
+    for (; i < count; i++)
+    {
+        sum += (uint32_t)pixels[i] * weights[i];
+    }
+    return sum;
+}
+
+static unsigned char video_sample(const unsigned char *plane, unsigned int stride, const Video_Area *area)
+{
+    const unsigned char *row = &plane[((size_t)area->y.first * stride) + area->x.first];
+    uint64_t sum = 0;
+
+    for (unsigned int y=0; y < area->y.count; y++)
+    {
+        sum += (uint64_t)area->y.weights[y] * video_dot(row, area->x.weights, area->x.count);
+        row += stride;
+    }
+
+    uint64_t total = (uint64_t)area->x.total * area->y.total;
+
+    return (unsigned char)((sum + (total / 2)) / total);
+}
+
+static unsigned char video_clamp(int32_t value)
+{
+    return (unsigned char)((value < 0) ? 0 : ((value > 255) ? 255 : value));
+}
+
+/* BT.601, the average of the planes is converted (the conversion is linear) */
+static void video_yuv(const Video_Context *context, unsigned char y, unsigned char u, unsigned char v, GFX_RGBA_Color *color)
+{
+    int32_t d = (int32_t)u - 128;
+    int32_t e = (int32_t)v - 128;
+
+    if (context->full)
+    {
+        int32_t c = (int32_t)y * 256;
+
+        color->red = video_clamp((c + (359 * e) + 128) >> 8);
+        color->green = video_clamp((c - (88 * d) - (183 * e) + 128) >> 8);
+        color->blue = video_clamp((c + (454 * d) + 128) >> 8);
+    }
+    else
+    {
+        int32_t c = ((int32_t)y - 16) * 298;
+
+        color->red = video_clamp((c + (409 * e) + 128) >> 8);
+        color->green = video_clamp((c - (100 * d) - (208 * e) + 128) >> 8);
+        color->blue = video_clamp((c + (516 * d) + 128) >> 8);
+    }
+}
+
+static void video_planes(Video_Context *context, unsigned int first, unsigned int last)
+{
+    const unsigned char *source = &context->current[(size_t)first * context->width * 3];
+    size_t count = (size_t)(last - first) * context->width;
+    unsigned char *red = &context->plane[0][(size_t)first * context->width];
+    unsigned char *green = &context->plane[1][(size_t)first * context->width];
+    unsigned char *blue = &context->plane[2][(size_t)first * context->width];
+    size_t i = 0;
+
+    #if defined(__ARM_NEON)
+        for (; (i + 16) <= count; i += 16)
+        {
+            uint8x16x3_t pixel = vld3q_u8(&source[i * 3]);
+
+            vst1q_u8(&red[i], pixel.val[0]);
+            vst1q_u8(&green[i], pixel.val[1]);
+            vst1q_u8(&blue[i], pixel.val[2]);
+        }
+    #endif
+
+    for (; i < count; i++)
+    {
+        red[i] = source[(i * 3)];
+        green[i] = source[(i * 3) + 1];
+        blue[i] = source[(i * 3) + 2];
+    }
+}
+
+static void video_work(Video_Context *context, unsigned int index)
+{
+    unsigned int first = (unsigned int)(((unsigned long)context->leds * index) / context->threads);
+    unsigned int last = (unsigned int)(((unsigned long)context->leds * (index + 1)) / context->threads);
+
+    if (context->format == Video_RGB)
+    {
+        video_planes(context, (unsigned int)(((unsigned long)context->height * index) / context->threads), (unsigned int)(((unsigned long)context->height * (index + 1)) / context->threads));
+        pthread_barrier_wait(&context->phase);
+
+        for (unsigned int i=first; i < last; i++)
+        {
+            const Video_Area *area = &context->map[i].luma;
+
+            context->colors[i] = (GFX_RGBA_Color){ context->intensity, video_sample(context->plane[0], context->width, area), video_sample(context->plane[1], context->width, area), video_sample(context->plane[2], context->width, area) };
+        }
+        return;
+    }
+
+    const unsigned char *luma = context->current;
+    const unsigned char *u = luma + ((size_t)context->width * context->height);
+    const unsigned char *v = u + ((size_t)context->chroma_width * context->chroma_height);
+
+    for (unsigned int i=first; i < last; i++)
+    {
+        const Video_Led *led = &context->map[i];
+
+        context->colors[i].alpha = context->intensity;
+        video_yuv(context, video_sample(luma, context->width, &led->luma), video_sample(u, context->chroma_width, &led->chroma), video_sample(v, context->chroma_width, &led->chroma), &context->colors[i]);
+    }
+}
+
+static void *video_thread(void *argument)
+{
+    Video_Worker *worker = argument;
+    Video_Context *context = worker->context;
+
+    for (;;)
+    {
+        pthread_barrier_wait(&context->start);
+
+        if (context->quit)
+        {
+            return 0;
+        }
+
+        video_work(context, worker->index);
+        pthread_barrier_wait(&context->done);
+    }
+}
+
+static int video_frame(Video_Context *context, unsigned char *frame)
+{
+    if (context->format != Video_RGB)
+    {
+        char line[VIDEO_HEADER];
+
+        if (video_line(context->input, line, sizeof(line)) || strncmp(line, "FRAME", 5))
+        {
+            return -1;
+        }
+    }
+    return video_read(context->input, frame, context->size);
+}
+
+static void video_usage(const char *name)
+{
+    fprintf(stderr, "usage: %s (-g WxH [-L layout] | -M map) [-s WxH] [-S size] [-i intensity] [-t threads] [-o output] [input|-]\n", name);
+    fprintf(stderr, "  -g WxH     LED matrix, -L wiring: any of s (serpentine), c (columns), x (flip x), y (flip y)\n");
+    fprintf(stderr, "  -M map     LED map file, one LED per line 'x y [w [h]]' in fractions of the frame, -S default size\n");
+    fprintf(stderr, "  -s WxH     raw RGB24 input of the given size instead of YUV4MPEG2\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static Video_Context context;
+    APA102_Matrix matrix = { 0, 0, APA102_Matrix_Progressive };
+    const char *map = 0;
+    const char *output = "/dev/null";
+    double size = 1.0 / 32.0;
+    unsigned int threads = (unsigned int)sysconf(_SC_NPROCESSORS_ONLN);
+    int option;
+
+    context.intensity = APA102_MAX_INTENSITY;
+
+    while ((option = getopt(argc, argv, "g:L:M:s:S:i:t:o:")) != -1)
+    {
+        switch (option)
+        {
+            case 'g': sscanf(optarg, "%ux%u", &matrix.width, &matrix.height); break;
+            case 'L':
+                for (const char *flag=optarg; *flag; flag++)
+                {
+                    matrix.layout |= (*flag == 's') ? APA102_Matrix_Serpentine : (*flag == 'c') ? APA102_Matrix_Columns : (*flag == 'x') ? APA102_Matrix_FlipX : (*flag == 'y') ? APA102_Matrix_FlipY : 0;
+                }
+                break;
+            case 'M': map = optarg; break;
+            case 's': sscanf(optarg, "%ux%u", &context.width, &context.height); context.format = Video_RGB; break;
+            case 'S': size = strtod(optarg, 0); break;
+            case 'i': context.intensity = (unsigned char)(strtoul(optarg, 0, 0) & APA102_MAX_INTENSITY); break;
+            case 't': threads = (unsigned int)strtoul(optarg, 0, 0); break;
+            case 'o': output = optarg; break;
+            default:
+                video_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if ((optind < argc) && strcmp(argv[optind], "-"))
+    {
+        context.input = open(argv[optind], O_RDONLY);
+
+        if (context.input < 0)
+        {
+            fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[optind]);
+            return 1;
+        }
+    }
+
+    if (context.format != Video_RGB)
+    {
+        char header[VIDEO_HEADER];
+
+        if (video_line(context.input, header, sizeof(header)) || strncmp(header, "YUV4MPEG2", 9) || video_y4m(&context, header))
+        {
+            fprintf(stderr, "%s: no YUV4MPEG2 stream (use -s WxH for raw RGB24)\n", argv[0]);
+            return 1;
+        }
+    }
+
+    context.chroma_width = (context.format == Video_YUV420) ? ((context.width + 1) / 2) : context.width;
+    context.chroma_height = (context.format == Video_YUV420) ? ((context.height + 1) / 2) : context.height;
+    context.size = (size_t)context.width * context.height;
+    context.size += (context.format == Video_RGB) ? (context.size * 2) : ((size_t)context.chroma_width * context.chroma_height * 2);
+
+    if (map)
+    {
+        int leds = video_map(&context, map, size, 0);
+
+        context.leds = (leds > 0) ? (unsigned int)leds : 0;
+    }
+    else
+    {
+        context.leds = matrix.width * matrix.height;
+    }
+
+    if (!context.width || !context.height || !context.leds || (context.leds > APA102_NUMBER_OF_LEDS) || !threads)
+    {
+        fprintf(stderr, "%s: invalid configuration (at most %u LEDs)\n", argv[0], (unsigned int)APA102_NUMBER_OF_LEDS);
+        video_usage(argv[0]);
+        return 1;
+    }
+
+    context.threads = (threads > VIDEO_THREADS) ? VIDEO_THREADS : threads;
+    context.map = calloc(context.leds, sizeof(Video_Led));
+    context.colors = calloc(context.leds, sizeof(GFX_RGBA_Color));
+    context.frame[0] = malloc(context.size);
+    context.frame[1] = malloc(context.size);
+    video_wire_size = APA102_FRAME_SIZE + ((unsigned long)context.leds * APA102_LED_FRAME_SIZE) + APA102_EOF_SIZE;
+    video_wire = malloc(video_wire_size);
+
+    if (!context.map || !context.colors || !context.frame[0] || !context.frame[1] || !video_wire)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return 1;
+    }
+
+    if (context.format == Video_RGB)
+    {
+        for (unsigned int i=0; i < 3; i++)
+        {
+            context.plane[i] = malloc((size_t)context.width * context.height);
+
+            if (!context.plane[i])
+            {
+                fprintf(stderr, "%s: out of memory\n", argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    if ((map ? (video_map(&context, map, size, 1) < 0) : video_grid(&context, &matrix)))
+    {
+        fprintf(stderr, "%s: cannot set up the LED map\n", argv[0]);
+        return 1;
+    }
+
+    int device = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (device < 0)
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], output);
+        return 1;
+    }
+
+    pthread_barrier_init(&context.start, 0, context.threads + 1);
+    pthread_barrier_init(&context.done, 0, context.threads + 1);
+    pthread_barrier_init(&context.phase, 0, context.threads);
+
+    for (unsigned int i=0; i < context.threads; i++)
+    {
+        context.worker[i].context = &context;
+        context.worker[i].index = i;
+        pthread_create(&context.worker[i].thread, 0, video_thread, &context.worker[i]);
+    }
+
+    fprintf(stderr, "%ux%u %s%s, %u LEDs, %u threads\n", context.width, context.height, (context.format == Video_RGB) ? "rgb24" : ((context.format == Video_YUV420) ? "y4m 4:2:0" : "y4m 4:4:4"), context.full ? " full range" : "", context.leds, context.threads);
+
+    unsigned long frames = 0;
+    uint64_t sample_total = 0, sample_maximum = 0, encode_total = 0;
+    uint64_t start = video_now();
+    unsigned int buffer = 0;
+    int more = !video_frame(&context, context.frame[buffer]);
+
+    while (more)
+    {
+        /* the workers sample the current frame while the next one is read */
+        uint64_t begin = video_now();
+
+        context.current = context.frame[buffer];
+        pthread_barrier_wait(&context.start);
+
+        buffer ^= 1;
+        more = !video_frame(&context, context.frame[buffer]);
+
+        pthread_barrier_wait(&context.done);
+
+        uint64_t sampled = video_now();
+
+        video_wire_length = 0;
+        APA102_SOF();
+
+        for (unsigned int i=0; i < context.leds; i++)
+        {
+            apa102_led(&context.colors[i]);
+        }
+
+        APA102_EOF();
+
+        if (write(device, video_wire, video_wire_length) != (ssize_t)video_wire_length)
+        {
+            fprintf(stderr, "%s: cannot write to %s\n", argv[0], output);
+            return 1;
+        }
+
+        uint64_t written = video_now();
+
+        sample_total += sampled - begin;
+        sample_maximum = ((sampled - begin) > sample_maximum) ? (sampled - begin) : sample_maximum;
+        encode_total += written - sampled;
+        frames++;
+    }
+
+    context.quit = 1;
+    pthread_barrier_wait(&context.start);
+
+    for (unsigned int i=0; i < context.threads; i++)
+    {
+        pthread_join(context.worker[i].thread, 0);
+    }
+
+    if (frames)
+    {
+        double elapsed = (video_now() - start) / 1e6;
+
+        fprintf(stderr, "%lu frames, %.1f fps, read+sample avg %.1f us (max %llu us), encode+write avg %.1f us",
+                frames, frames / elapsed, (double)sample_total / frames, (unsigned long long)sample_maximum, (double)encode_total / frames);
+
+        if (context.fps > 0.0)
+        {
+            fprintf(stderr, ", source %.2f fps (%s)", context.fps, ((frames / elapsed) >= context.fps) ? "real time" : "too slow");
+        }
+        fprintf(stderr, "\n");
+    }
+
+    close(device);
+    return 0;
+}